@@ -31,12 +31,12 @@ clean_all() {
 
 arg_error() {
   echo -e " Error: no arguments provided.\n "
-  echo -e " Usage: $0 [ --run | --memcheck | --clean ]\n "
+  echo -e " Usage: $0 [ --run | --memcheck | --bench | --report | --clean ]\n "
 }
 
 inv_arg_error() {
   echo -e " Error: Invalid argument '$1'\n "
-  echo -e " Usage: $0 [ --run | --memcheck | --clean ]\n "
+  echo -e " Usage: $0 [ --run | --memcheck | --bench | --report | --clean ]\n "
   exit 1;
 }
 
@@ -62,11 +62,21 @@ build_project() {
   make main || { echo "Build failed"; exit 1; }
 }
 
+bench_project() {
+  # Build & run the headless render benchmark, the game is not started
+  cd ../build || { echo "Failed to change directory to 'build'"; exit 1; }
+  cmake ../config/ || { echo "CMake configuration failed"; exit 1; }
+  make render_bench || { echo "Build failed"; exit 1; }
+  ./render_bench "$@"
+}
+
 run_project() {
   # Run program with ./main or debug with valgrind
   if [[ "$1" == "--memcheck" ]]; then
       echo "Running valgrind to check memory usage of the program..."
       valgrind --tool=memcheck --track-origins=yes --log-file=../logs/memcheck.log ./main #--leak-check=full
+  elif [[ "$1" == "--report" ]]; then
+      ./main --report
   else
       echo "Build successful. running the program..."
       ./main
@@ -79,7 +89,7 @@ if [[ $# -eq 0 ]]; then
     exit 1
 fi
 
-# Check provided arguments "--run", "--memcheck", "--clean", or "--clean-all".
+# Check provided arguments "--run", "--memcheck", "--bench", "--report", "--clean", or "--clean-all".
 if [[ "$1" == "--clean" ]]; then
     clean
     exit 0
@@ -89,6 +99,22 @@ if [[ "$1" == "--clean-all" ]]; then
     exit 0
 fi
 
+if [[ "$1" == "--bench" ]]; then
+    setup_directories
+
+    bench_project "${@:2}"
+    exit 0
+fi
+
+if [[ "$1" == "--report" ]]; then
+    setup_directories
+
+    build_project
+
+    run_project "$@"
+    exit 0
+fi
+
 if [[ "$1" == "--memcheck" ]] || [[ "$1" == "--run" ]]; then
     delete_log_file
 
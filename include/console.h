@@ -9,9 +9,12 @@
 #include <fcntl.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <signal.h>
 #include <execinfo.h>
 
+#include "render.h"
+
 // TODO : Flag to ignore the set_console_sursor_position in the mvprint function
 typedef enum COORDINATES {
     NUL = -0x00000001
@@ -32,6 +35,14 @@ typedef enum TERMUTILS {
     MIN_OFFSET_POS =  0x00000005,
 } tstats_t;
 
+// TODO : DEC private modes & the reply timeout of the terminal queries
+typedef enum TERM_MODES {
+    ALT_SCREEN    = 0x00000419, //? Alternate screen buffer, saves & restores the main screen
+    SYNC_OUTPUT   = 0x000007EA, //? Synchronized output, the terminal draws a frame at once
+    PASTE_MODE    = 0x000007D4, //? Bracketed paste, pasted text is wrapped in '\033[200~' & '\033[201~'
+    PROBE_TIMEOUT = 0x000000C8, //? Milliseconds to wait for the reply of a query
+} tmodes_t;
+
 // TODO : For styling output texts both foreground and background
 typedef enum TEXT_STYLES {
     RAW        = -0x00000001,
@@ -84,18 +95,18 @@ void set_fg_color(uint8_t);
 void set_bg_color(uint8_t);
 
 void signal_handler(int);
-void handle_sigwinch(int);
 void setup_signal_handler(void);
 int  get_win_size(int *, int *);
-void setup_sigwinch_handler(int *);
 
-int get_arrow_key(int);
-int highlight_line(int, int, int);
+int  get_arrow_key(int);
+int  highlight_line(int, int, int);
+bool read_menu_keys(int, int *);
 
 void restore_terminal(void);
 int  check_console_req(void);
 void get_box_offset_pos(int);
 void initialize_terminal(void);
+void initialize_headless(rtargets_t);
 void set_console_text_attr(int);
 void set_console_cursor_mode(int);
 void draw_box(int, int, int, int);
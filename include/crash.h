@@ -0,0 +1,37 @@
+/**
+ * @file crash.h
+ * @brief This header file defines the crash reporter of the game. Its file descriptor, alternate signal stacks
+ *        & buffers are set up at startup, so when the game crashes the handler only makes async-signal-safe
+ *        calls to write the backtrace, the last UI events & the state of the database to the log file.
+**/
+#ifndef CRASH_H
+#define CRASH_H
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits of the crash reporter
+typedef enum CRASH_SIZES {
+    CRASH_STACK   = 0x00010000, //? Bytes of the alternate signal stack at least, a stack overflow can still be reported
+    CRASH_UNWIND  = 0x00008000, //? Bytes left to the handler & the unwinder above the signal frame of the kernel
+    CRASH_FRAMES  = 0x00000040, //? Frames of the backtrace
+    CRASH_EVENTS  = 0x00000020, //? UI events kept for the report, a power of two
+    CRASH_SQL     = 0x00000080, //? Bytes kept of the last SQL statement
+    CRASH_LINE    = 0x00000100,
+} csizes_t;
+
+// TODO : Kinds of the UI events kept for the report
+typedef enum CRASH_EVENT {
+    CRASH_KEY     = 0x00000001, //? A key press, with its key code & modifiers
+    CRASH_SCENE   = 0x00000002, //? A scene was entered, with its id & the depth of the scene stack
+    CRASH_RESIZE  = 0x00000003, //? The terminal was resized, with its columns & rows
+} cevent_t;
+
+bool crash_init(void);
+bool crash_thread_begin(void);
+void crash_thread_end(void);
+bool crash_handle(int);
+void crash_event(cevent_t, int32_t, int32_t);
+
+#endif //CRASH_H
@@ -8,40 +8,82 @@
 
 #include "global.h"
 #include "gamecore.h"
+#include "tasks.h"
+#include "histogram.h"
+#include "seen.h"
 
 #define DBFILEPATH "../data/database.db"
 
+// TODO : Outcomes of an answered question, as saved in the 'answers' table
+typedef enum ANSWER_OUTCOME {
+    ANSWER_INCORRECT = 0x00000000,
+    ANSWER_CORRECT   = 0x00000001,
+    ANSWER_SKIPPED   = 0x00000002,
+} outcome_t;
+
 // TODO : Structfor holding the question & answers in the Quiz Game.
 typedef struct QUIZ {
-    int question_id;
-    char question[MAX_BUFF];
-    char correct_choice[BUF_SIZE];
-    char selected_choice[BUF_SIZE];
-    char choices[MAX_CHOICES][BUF_SIZE];
+    int question_id;                //? Primary key of the question in its table
+    outcome_t outcome;
+    uint32_t latency_ms;            //? Time the player took to answer it
+    uint8_t correct;                //? Index of the correct choice
+    uint8_t selected;               //? Index of the selected choice, MAX_CHOICES if the question is skipped
+    uint8_t order[MAX_CHOICES];     //? Indexes of the choices in the order they are shown in this game, from [A]
+    char question[QUESTION_SIZE];
+    char choices[MAX_CHOICES][BUF_SIZE];  //? Without their letter, which depends on the order
 } quiz_t;
 
+// TODO : Struct for holding a question of a game once answered, without its text, which is read back to be reviewed
+typedef struct ANSWER {
+    int question_id;
+    outcome_t outcome;
+    uint32_t latency_ms;
+    uint8_t correct;
+    uint8_t selected;
+    uint8_t order[MAX_CHOICES];
+} answer_t;
+
+// TODO : Struct for holding the result of a game, saved with the time taken on each of its questions
+typedef struct GAME_RESULT {
+    const char      *category;
+    const answer_t  *answers;
+    size_t           count;
+    uint32_t         score;
+    uint32_t         bonus;
+    uint32_t         skipped;
+    const gtiming_t *timing;
+} gresult_t;
+
 
 bool setup(void);
 bool create_new_database(void);
 bool insert_quiz_questions_answers(sqlite3 *);
 bool get_player_data(const char *, pstats_t *);
+bool authenticate_player(const char *, const char *, pstats_t *);
 bool reset_badges_table(sqlite3 *, const char *);
 bool reset_players_table(sqlite3 *, const char *);
 
 bool retrieve_badges_table(sqlite3 *, pstats_t *, const char *);
 bool retrieve_players_table(sqlite3 *, pstats_t *, const char *);
 bool retrieve_accounts_table(sqlite3 *, account_t *, const char *);
+bool retrieve_player_record(sqlite3 *, pstats_t *, const char *, const char *);
 
 bool update_gamestats(const pstats_t *);
 bool update_score(pstats_t *, uint32_t, uint32_t, uint32_t);
 bool insert_new_player_data(const account_t *, const pstats_t *);
+bool insert_game_result(const pstats_t *, const gresult_t *);
+bool delete_game_results(sqlite3 *, const char *);
+bool retrieve_player_latency(sqlite3 *, const char *, histogram_t *);
+bool retrieve_seen_questions(sqlite3 *, const char *, const char *, seen_t *);
+bool print_question_report(FILE *, size_t);
 bool delete_player_data(sqlite3 *, const pstats_t *, const char *);
 bool insert_quiz_data(sqlite3 *, const quiz_t *, size_t, const char *);
 bool update_player_data(sqlite3 *, const char *, const char *, const char *, const char *);
 
-uint32_t check_answer(quiz_t *, short);
-void display_answered(int, pstats_t *, quiz_t *);
-void display_questions(int, pstats_t *, const char *);
-bool get_questions(sqlite3 *, quiz_t *, const char *, size_t);
+uint32_t check_answer(quiz_t *, bool);
+void display_answered(int, pstats_t *, const gresult_t *);
+transition_t display_questions(session_t *);
+void prefetch_discard(void);
+bool get_questions(sqlite3 *, quiz_t *, const char *, size_t, rng_t *, seen_t *, task_t *);
 
 #endif //DB_H
@@ -0,0 +1,40 @@
+/**
+ * @file events.h
+ * @brief This header file defines the event loop of the game. One poll() multiplexes stdin, the timers
+ *        driving the animations, & the signals, which are forwarded through a self-pipe so their handlers
+ *        run outside of the signal context.
+**/
+#ifndef EVENTS_H
+#define EVENTS_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits of the event loop
+typedef enum EVENT_SIZES {
+    WAKE_EVENT    =  0x00000000, //? Byte written into the self-pipe to wake the loop, 0 is no signal
+    MAX_TIMERS    =  0x00000010,
+    NO_TIMER      = -0x00000001, //? Returned when every timer slot is taken
+    WAIT_FOREVER  = -0x00000001, //? Timeout of a poll that only returns on an event
+} esizes_t;
+
+// TODO : Callback types of the event loop
+typedef void (*timer_cb)(void *);
+typedef void (*signal_cb)(int);
+
+bool     events_init(void);
+bool     events_handle_signal(int, signal_cb);
+void     events_wake(void);
+uint64_t events_now(void);
+
+int  events_add_timer(uint32_t, bool, timer_cb, void *);
+void events_cancel_timer(int);
+
+void events_run_once(int);
+void events_run_until(const volatile bool *);
+void events_sleep(uint32_t);
+int  events_wait_key(void);
+
+#endif //EVENTS_H
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "global.h"
+#include "timing.h"
+#include "rng.h"
 #include "utilities.h"
 #include "gamemath.h"
 
@@ -82,32 +84,81 @@ typedef struct PLAYERSTATS {
 } pstats_t ;
 
 
-void login(int);
-void signup(int);
-void logout(int, void *);
-void homepage(int);
-void mainmenu(int, pstats_t *);
-void settings(int, pstats_t *);
-void gameplay(int, pstats_t *);
-void play_as_guest(int);
-void guestplayer_mode(int);
-
-void reset_score(int, pstats_t *);
-void edit_account(int, pstats_t *);
-void delete_account(int, pstats_t *);
-void manage_account(int, pstats_t *);
+// TODO : The scenes of the game, each one is a screen run by the dispatch loop of 'scene_run'
+typedef enum SCENES {
+    SCENE_NONE           = 0x00000000,
+    SCENE_HOMEPAGE       = 0x00000001,
+    SCENE_LOGIN          = 0x00000002,
+    SCENE_SIGNUP         = 0x00000003,
+    SCENE_GUEST_MODE     = 0x00000004,
+    SCENE_GUEST_GAME     = 0x00000005,
+    SCENE_MAINMENU       = 0x00000006,
+    SCENE_HELP           = 0x00000007,
+    SCENE_GAMEPLAY       = 0x00000008,
+    SCENE_QUESTIONS      = 0x00000009,
+    SCENE_SETTINGS       = 0x0000000A,
+    SCENE_SCOREBOARD     = 0x0000000B,
+    SCENE_GAMESTATS      = 0x0000000C,
+    SCENE_MANAGE_ACCOUNT = 0x0000000D,
+    SCENE_MODIFY_ACCOUNT = 0x0000000E,
+    SCENE_EDIT_ACCOUNT   = 0x0000000F,
+    SCENE_DELETE_ACCOUNT = 0x00000010,
+    SCENE_RESET_ACCOUNT  = 0x00000011,
+    SCENE_COUNT
+} scenes_t;
+
+// TODO : What the dispatch loop does with the stack of scenes when a scene returns
+typedef enum SCENE_GOTO {
+    GOTO_PUSH     = 0x00000000, //? Enter the scene on top of the current one, going back returns to it
+    GOTO_REPLACE  = 0x00000001, //? Enter the scene in place of the current one
+    GOTO_BACK     = 0x00000002, //? Leave the current scene for the one below it, the game ends below the first one
+    GOTO_RETURN   = 0x00000003, //? Leave the scenes above the given one, or start over from it if it isn't on the stack
+    GOTO_QUIT     = 0x00000004, //? End the game
+} goto_t;
+
+// TODO : Struct for holding what a scene returns to the dispatch loop
+typedef struct TRANSITION {
+    goto_t   action;
+    scenes_t scene;
+} transition_t;
+
+// TODO : Struct for holding the state shared by the scenes of a game session
+typedef struct SESSION {
+    int         box_offset;
+    pstats_t    player;      //? The logged in player, cleared on logout
+    const char *category;    //? Category of the next game, set by the gameplay menu
+    int         mode;        //? EDITACCOUNT, DELETEACCOUNT or RESETACCOUNT for the modify account scene
+    bool        marathon;    //? The next games are marathons, toggled by the gameplay menu
+    rng_t       rng;         //? Picks the categories & questions of the games, seeded once per session
+} session_t;
+
+
+transition_t login(session_t *);
+transition_t signup(session_t *);
+transition_t logout(session_t *);
+transition_t homepage(session_t *);
+transition_t mainmenu(session_t *);
+transition_t settings(session_t *);
+transition_t gameplay(session_t *);
+transition_t display_help(session_t *);
+transition_t play_as_guest(session_t *);
+transition_t guestplayer_mode(session_t *);
+
+transition_t edit_account(session_t *);
+transition_t delete_account(session_t *);
+transition_t manage_account(session_t *);
+transition_t modify_account(session_t *);
+transition_t display_gamestats(session_t *);
+transition_t display_scoreboard(session_t *);
+transition_t reset_account_data(session_t *);
 void assign_new_player_id(char *);
-void display_gamestats(int, pstats_t *);
-void display_scoreboard(int , pstats_t *);
-void reset_account_data(int, pstats_t *);
-void modify_account(int, int, pstats_t *);
 
 bool get_new_user_info(int, int, account_t *);
 bool init_default_player_stats(account_t *, pstats_t *);
 bool init_new_player_stats(pstats_t *, account_t *);
 ssize_t edit_field(int, int, const char *, char *, size_t);
 
-void unlock_achievements(pstats_t *, uint32_t, double);
-void getnew_playerstats(pstats_t *, uint32_t, uint32_t, uint32_t, uint32_t, double);
+void unlock_achievements(pstats_t *, uint32_t, uint32_t, const gtiming_t *);
+void getnew_playerstats(pstats_t *, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, const gtiming_t *);
 
 #endif //PLAYERSTATS_H
@@ -7,15 +7,16 @@
 #define GAMEMATH_H
 #pragma once
 
+#include "timing.h"
 #include "utilities.h"
 
 uint32_t games_completed(uint32_t);
-uint32_t assign_bonus(uint32_t, double);
-uint32_t get_lstreaks(uint32_t, uint32_t);
+uint32_t assign_bonus(uint32_t, uint32_t, const gtiming_t *);
+uint32_t get_lstreaks(uint32_t, uint32_t, uint32_t);
 uint32_t get_total_correct_answers(uint32_t);
-uint32_t get_total_incorrect_answers(uint32_t);
+uint32_t get_total_incorrect_answers(uint32_t, uint32_t);
 uint32_t get_highest_score(uint32_t, uint32_t);
-uint32_t get_total_question_attempted(uint32_t);
+uint32_t get_total_question_attempted(uint32_t, uint32_t);
 uint32_t get_average_time(uint32_t, double, uint32_t);
 uint32_t get_average_score(uint32_t, uint32_t, uint32_t);
 
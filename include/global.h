@@ -10,6 +10,7 @@
 typedef enum QUIZ_FLAGS {
     NIL         = 0x00000000,
     SKIP        = 0x00000001,
+    QUIT        = 0x00000002,   //? A marathon is ended by the player
     COMPLETED   = 0x00000001,
     INCOMPLETED = 0x00000000,
 } qconst_t;
@@ -74,12 +75,17 @@ typedef enum CONSTANTS {
     MIN_BUFF       = 0x00000080,
     MAX_BUFF       = 0x000000100,
     MAX_CHOICES    = 0x00000004,
-    MAX_QUESTIONS  = 0x0000000A,
+    MAX_QUESTIONS  = 0x0000000A, //? Questions of a game, & of each batch a marathon is streamed in
+    MAX_MARATHON   = 0x000001F4, //? Questions of a marathon at most, the player may end it before
     INITIAL_SCORE  = 0x00000000,
     MAXIMUM_SCORE  = 0x00000064,
     LEFT_PADDING   = 0x00000007,
     RIGHT_PADDING  = 0x00000007,
     PROMPT_PADDING = 0x0000000D,
+    FRAME_DELAY    = 0x00000032, //? Milliseconds between two frames of the loader & progress bar
+    BOARD_COLUMNS  = 0x00000003, //? Separators between the columns of the scoreboard
+    QUESTION_ROWS  = 0x00000007, //? Rows of a question & its choices during a game
+    REVIEW_ROWS    = 0x00000003, //? Rows of a question on the answers page, its answers take one less
 } const_t;
 
 // TODO : Constant sizes and array buffer limits
@@ -93,20 +99,33 @@ typedef enum SIZES {
     UNAME_SIZE     = 0x00000014,
     FRAME_SIZE     = 0x00000032, //? For the loader & progress bar
     BADGE_SIZE     = 0x00000010, //? For badges & emojis
+    QUESTION_SIZE  = 0x00000400, //? For the text of a question, it is wrapped to the box
 } sizes_t;
 
 // TODO : For string terminator, terminal control keys, etc...
+//? The keys decoded from escape sequences are above the byte range, so they never clash with typed characters
 typedef enum CONTROL_KEYS{
     LEFT_SQB     = 0x0000005b,  //? Left Square Bracket '['
     ESC_KEY      = 0x0000001b,  //? Escape Key
-    UP_KEY       = 0x00000041,  //? 'A'
-    DOWN_KEY     = 0x00000042,  //? 'B'
-    LEFT_KEY     = 0x00000044,  //? 'D'
-    RIGHT_KEY    = 0x00000043,  //? 'C'
     ENTER_KEY    = 0x0000000A,  //? '\n'
     BACKSPACE    = 0x0000007F,  //? '\b'
     SPACE_BAR    = 0x00000020,  //? '  '
     NULL_TERM    = '\0',        //? Null terminator
+    UP_KEY       = 0x00000101,
+    DOWN_KEY     = 0x00000102,
+    LEFT_KEY     = 0x00000103,
+    RIGHT_KEY    = 0x00000104,
+    HOME_KEY     = 0x00000105,
+    END_KEY      = 0x00000106,
+    PGUP_KEY     = 0x00000107,
+    PGDN_KEY     = 0x00000108,
+    INSERT_KEY   = 0x00000109,
+    DELETE_KEY   = 0x0000010A,
+    BACKTAB_KEY  = 0x0000010B,  //? SHIFT + TAB
+    PASTE_KEY    = 0x0000010C,  //? A bracketed paste, the text is read with 'keys_paste'
+    UNKNOWN_KEY  = 0x0000010D,  //? A sequence that isn't mapped to a key, or that was cut short
+    F1_KEY       = 0x00000110,  //? F1 to F12 follow each other
+    F12_KEY      = 0x0000011B,
 } ctrl_t;
 
 // TODO : Constants for menu options used in switch expression
@@ -139,6 +158,7 @@ typedef enum MENUS {
     SCIENCE            = 0x00000000,
     SPORTS             = 0x00000001,
     GENERALKNOWLEDGE   = 0x00000002,
+    MARATHON           = 0x00000004,
 
     //? Shared
     MAINMENU           = 0x00000003
@@ -0,0 +1,38 @@
+/**
+ * @file histogram.h
+ * @brief This header file defines the latency histograms of the game. Values (milliseconds) are counted in
+ *        log-bucketed bins, 4 per power of two, so a histogram takes a fixed few hundred bytes whatever it holds,
+ *        its percentiles are within ~12% of the exact value, & two histograms are merged by adding their bins.
+**/
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits of the histograms
+typedef enum HISTOGRAM_SIZES {
+    HIST_SUB      = 0x00000004, //? Bins per power of two
+    HIST_BITS     = 0x00000016, //? Values up to 2^22 ms (~70 minutes), larger ones are counted in the last bin
+    HIST_BINS     = 0x00000054, //? HIST_SUB * (HIST_BITS - 1), the values below HIST_SUB have a bin each
+    HIST_VERSION  = 0x00000001, //? Layout of the saved histograms
+    HIST_HEADER   = 0x0000000B, //? Version byte, u16 bin count, u32 count & u32 max, the u32 bins follow
+    HIST_BLOB     = 0x0000015B, //? HIST_HEADER + 4 * HIST_BINS
+} hsizes_t;
+
+// TODO : Struct for holding a latency histogram, it is saved little-endian in the database by hist_save
+typedef struct HISTOGRAM {
+    uint32_t bins[HIST_BINS];
+    uint32_t count;
+    uint32_t max;
+} histogram_t;
+
+void     hist_record(histogram_t *, uint32_t);
+void     hist_merge(histogram_t *, const histogram_t *);
+uint32_t hist_percentile(const histogram_t *, double);
+size_t   hist_save(const histogram_t *, uint8_t *);
+bool     hist_load(histogram_t *, const void *, size_t);
+
+#endif //HISTOGRAM_H
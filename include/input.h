@@ -0,0 +1,33 @@
+/**
+ * @file input.h
+ * @brief This header file defines the input layer of the terminal. The terminal is switched to
+ *        non-canonical mode once, & every read fills a ring buffer that the key readers consume.
+**/
+#ifndef INPUT_H
+#define INPUT_H
+#pragma once
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+// TODO : Sizes & flags of the input layer
+typedef enum INPUT_SIZES {
+    INPUT_RING    =  0x00000400, //? Bytes held by the ring buffer, a power of two
+    INPUT_EOF     = -0x00000001, //? Returned when stdin is closed or fails
+    INPUT_TIMEOUT = -0x00000002, //? Returned when no byte arrived in time
+} isizes_t;
+
+bool input_init(void);
+void input_restore(void);
+
+int     input_getc(void);
+int     input_getc_timeout(int);
+void    input_unget(void);
+void    input_push(const char *, size_t);
+bool    input_full(void);
+bool    input_pending(void);
+size_t  input_fill(int);
+ssize_t input_read(void);
+
+#endif //INPUT_H
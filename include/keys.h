@@ -0,0 +1,42 @@
+/**
+ * @file keys.h
+ * @brief This header file defines the key decoder of the game. Escape sequences (CSI '\033[' & SS3 '\033O')
+ *        are decoded from the ring buffer of the input layer into single key codes, using lookup tables,
+ *        so an arrow key is one key press & a lone ESC doesn't wait for bytes that never come.
+**/
+#ifndef KEYS_H
+#define KEYS_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits & timeout of the key decoder
+typedef enum KEY_SIZES {
+    ESC_TIMEOUT   = 0x00000032, //? Milliseconds to wait for the next byte of a sequence that was cut short
+    MAX_PARAMS    = 0x00000004, //? Numeric parameters kept from a CSI sequence
+    MAX_PASTE     = 0x00001000, //? Bytes kept from a bracketed paste, the rest is dropped
+    PASTE_START   = 0x000000C8, //? '\033[200~'
+    PASTE_END     = 0x000000C9, //? '\033[201~'
+} ksizes_t;
+
+// TODO : Modifier keys held with a decoded key, from the second parameter of the sequence minus one
+typedef enum KEY_MODIFIERS {
+    MOD_NONE      = 0x00000000,
+    MOD_SHIFT     = 0x00000001,
+    MOD_ALT       = 0x00000002,
+    MOD_CTRL      = 0x00000004,
+} kmods_t;
+
+// TODO : Struct for holding a decoded key press
+typedef struct KEY_EVENT {
+    int      key;   //? A byte, or a key code of 'ctrl_t' above the byte range
+    uint8_t  mods;  //? 'kmods_t' flags
+} kevent_t;
+
+int         keys_read(kevent_t *);
+bool        keys_pending(void);
+const char *keys_paste(size_t *);
+
+#endif //KEYS_H
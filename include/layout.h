@@ -0,0 +1,26 @@
+/**
+ * @file layout.h
+ * @brief This header file defines the layout of the screens on the terminal. The screens draw on a logical
+ *        canvas of the minimum window size, which is centered on the terminal & placed again when the
+ *        terminal is resized. A terminal smaller than the canvas shows a notice until it is enlarged.
+**/
+#ifndef LAYOUT_H
+#define LAYOUT_H
+#pragma once
+
+#include <stdbool.h>
+
+#include "console.h"
+
+// TODO : Size of the logical canvas the screens draw on
+typedef enum LAYOUT_SIZES {
+    CANVAS_WIDTH  = MIN_WIN_WIDTH,
+    CANVAS_HEIGHT = MIN_WIN_HEIGHT,
+} lsizes_t;
+
+bool layout_init(void);
+void layout_refresh(void);
+bool layout_fits(void);
+int  layout_box_offset(void);
+
+#endif //LAYOUT_H
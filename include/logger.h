@@ -0,0 +1,40 @@
+/**
+ * @file logger.h
+ * @brief This header file defines the logger of the game. A record is formatted into a preallocated
+ *        lock-free ring, & a background thread writes the records to the log file, one line each,
+ *        so logging never blocks the UI thread on file I/O. Records below the log level are skipped,
+ *        & a call site logging too often in one second is rate limited.
+**/
+#ifndef LOGGER_H
+#define LOGGER_H
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits of the logger
+typedef enum LOG_SIZES {
+    LOG_RING      = 0x00000100, //? Records waiting for the flusher, a power of two
+    LOG_RECORD    = 0x00000100, //? Bytes of the message of a record, a longer message is cut
+    LOG_SITES     = 0x00000040, //? Slots of the rate limiter, a power of two
+    LOG_BURST     = 0x00000008, //? Records a call site may log per second
+} logsizes_t;
+
+// TODO : Levels of the log records, QUIZBIT_LOG_LEVEL sets the lowest level logged
+typedef enum LOG_LEVEL {
+    LEVEL_DEBUG   = 0x00000000,
+    LEVEL_INFO    = 0x00000001,
+    LEVEL_WARN    = 0x00000002,
+    LEVEL_ERROR   = 0x00000003,
+} loglevel_t;
+
+void log_init(void);
+void log_shutdown(void);
+void log_set_level(loglevel_t);
+bool log_enabled(loglevel_t);
+void log_vwrite(loglevel_t, const char *, const char *, int, const char *, va_list) __attribute__((format(printf, 5, 0)));
+void log_write(loglevel_t, const char *, const char *, int, const char *, ...) __attribute__((format(printf, 5, 6)));
+
+#endif //LOGGER_H
@@ -0,0 +1,37 @@
+/**
+ * @file output.h
+ * @brief This header file defines the output sink of the terminal. Everything written to the terminal
+ *        is appended to one growable byte buffer, which is flushed once per frame. Without a terminal
+ *        (ie: the headless render targets), the frames are counted & dropped instead of written.
+**/
+#ifndef OUTPUT_H
+#define OUTPUT_H
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Struct for holding the write counters of the output sink
+typedef struct OUTPUT_STATS {
+    uint64_t frames;          //? Number of committed frames that held bytes
+    uint64_t totalBytes;
+    uint64_t totalSyscalls;
+    size_t   frameBytes;      //? Bytes of the last committed frame
+    uint32_t frameSyscalls;   //? write/writev calls of the last committed frame, 0 when discarded
+} ostats_t;
+
+void out_write(const char *, size_t);
+void out_printf(const char *, ...) __attribute__((format(printf, 1, 2)));
+void out_vprintf(const char *, va_list) __attribute__((format(printf, 1, 0)));
+
+bool   out_commit(void);
+size_t out_pending(void);
+void   out_stats(ostats_t *);
+void   out_set_sync(bool);
+bool   out_sync_enabled(void);
+void   out_set_discard(bool);
+void   out_set_fd(int);
+
+#endif //OUTPUT_H
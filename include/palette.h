@@ -0,0 +1,45 @@
+/**
+ * @file palette.h
+ * @brief This header file defines the color palette of the game. The SGR parameters of every color
+ *        & the escape sequences of the fixed color themes are built once, then looked up when drawing.
+**/
+#ifndef PALETTE_H
+#define PALETTE_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "console.h"
+
+// TODO : The fixed color themes of the game
+typedef enum COLOR_THEMES {
+    THEME_ERROR,         //? White on red
+    THEME_SUCCESS,       //? White on green
+    THEME_BANNER,        //? Yellow on dark red
+    THEME_HIGHLIGHT,     //? Black on white
+    THEME_PROGRESS_DONE, //? Gold background
+    THEME_PROGRESS_LEFT, //? Slate grey background
+    THEME_COUNT
+} themes_t;
+
+// TODO : Sizes of the precomputed SGR strings
+typedef enum PALETTE_SIZES {
+    SGR_PARAM_SIZE = 0x00000014, //? Longest color parameter, ie: "48;2;255;255;255"
+    SGR_THEME_SIZE = 0x00000030, //? Longest theme sequence (foreground & background)
+} psizes_t;
+
+void palette_init(void);
+bool palette_truecolor(void);
+
+uint8_t  palette_index(RGB_t);
+uint32_t palette_color(RGB_t);
+void     palette_theme(themes_t, uint32_t *, uint32_t *);
+
+const char *palette_param(uint32_t, bool, size_t *);
+const char *palette_theme_sgr(themes_t, size_t *);
+
+void set_console_theme(themes_t);
+
+#endif //PALETTE_H
@@ -0,0 +1,73 @@
+/**
+ * @file render.h
+ * @brief This header file defines the double-buffered cell grid renderer. Every screen draws into
+ *        the back buffer, and the present step sends only the cells that changed since the last frame.
+ *        The frames are presented to a target, the terminal or, to drive the screens headlessly,
+ *        the in-memory front buffer alone or nothing at all.
+**/
+#ifndef RENDER_H
+#define RENDER_H
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Constant sizes used by the cell grid
+typedef enum RENDER_SIZES {
+    GLYPH_SIZE   = 0x00000008, //? UTF-8 bytes of one glyph (codepoint + combining marks)
+    WIDE_GLYPH   = 0x00000002, //? Width of a double width glyph
+    SPAN_GAP     = 0x00000008, //? Unchanged cells re-sent instead of moving the cursor
+    TAB_WIDTH    = 0x00000008,
+} rsizes_t;
+
+// TODO : Flags for the color values stored in a cell
+typedef enum CELL_COLORS {
+    COLOR_DEFAULT = 0x00000000, //? Terminal default color
+    COLOR_INDEXED = 0x01000000, //? 256 color mode index in the low byte
+    COLOR_RGB     = 0x02000000, //? 24-bit color in the low three bytes
+} ccolors_t;
+
+// TODO : The targets the frames are presented to
+typedef enum RENDER_TARGETS {
+    TARGET_TERMINAL = 0x00000000, //? Diffed & written to stdout
+    TARGET_MEMORY   = 0x00000001, //? Diffed into the front buffer, read back with 'render_peek', the bytes are counted only
+    TARGET_NULL     = 0x00000002, //? Dropped without being diffed
+} rtargets_t;
+
+// TODO : Struct for holding a single cell of the screen
+typedef struct CELL {
+    char     glyph[GLYPH_SIZE]; //? NUL padded, empty for the right half of a wide glyph
+    uint32_t fg;
+    uint32_t bg;
+    uint16_t style;             //? Bitmask of the 'styles_t' SGR codes
+    uint8_t  width;             //? 1 or 2, 0 for the right half of a wide glyph
+    uint8_t  reserved;
+} cell_t;
+
+bool render_init(void);
+bool render_active(void);
+void render_shutdown(void);
+void render_set_target(rtargets_t);
+rtargets_t render_target(void);
+bool render_peek(int, int, cell_t *);
+size_t render_peek_row(int, char *, size_t);
+
+void render_clear(void);
+size_t render_cells(void);
+bool render_snapshot(cell_t *, size_t);
+bool render_blit(const cell_t *, size_t);
+void render_set_viewport(int, int, bool);
+void render_present(void);
+void render_move(int, int);
+void render_backspace(size_t);
+void render_set_style(int);
+void render_set_fg(uint32_t);
+void render_set_bg(uint32_t);
+void render_set_cursor_visible(bool);
+
+void render_write(const char *, size_t);
+void render_vprintf(const char *, va_list) __attribute__((format(printf, 1, 0)));
+
+#endif //RENDER_H
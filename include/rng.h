@@ -0,0 +1,27 @@
+/**
+ * @file rng.h
+ * @brief This header file defines the random number generator of the game (xoshiro256**). Each session holds
+ *        its own generator, which picks the categories, samples the questions & shuffles the choices, so
+ *        a session seeded with QUIZBIT_SEED replays the same games, ie: for benchmarks & load tests.
+**/
+#ifndef RNG_H
+#define RNG_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Struct for holding the state of a generator, it must not be all zero
+typedef struct RNG {
+    uint64_t s[4];
+} rng_t;
+
+bool     rng_init(rng_t *);
+void     rng_seed(rng_t *, uint64_t);
+void     rng_entropy(rng_t *);
+void     rng_fork(rng_t *, rng_t *);
+uint64_t rng_next(rng_t *);
+uint32_t rng_below(rng_t *, uint32_t);
+
+#endif //RNG_H
@@ -0,0 +1,29 @@
+/**
+ * @file scene.h
+ * @brief This header file defines the scene manager of the game. Every screen is a scene that draws itself,
+ *        waits for the player, then returns a transition instead of calling the next screen. One dispatch loop
+ *        applies the transitions to a bounded stack of scenes, so the call stack & the memory stay the same
+ *        however many screens are visited.
+**/
+#ifndef SCENE_H
+#define SCENE_H
+#pragma once
+
+#include "gamecore.h"
+
+// TODO : Limits of the scene manager
+typedef enum SCENE_SIZES {
+    SCENE_STACK   = 0x00000008, //? Scenes kept to go back to, a push on a full stack replaces the top scene
+} ssizes_t;
+
+typedef transition_t (*scene_t)(session_t *);
+
+transition_t scene_push(scenes_t);
+transition_t scene_replace(scenes_t);
+transition_t scene_back(void);
+transition_t scene_return(scenes_t);
+transition_t scene_quit(void);
+
+void scene_run(session_t *, scenes_t);
+
+#endif //SCENE_H
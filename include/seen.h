@@ -0,0 +1,39 @@
+/**
+ * @file seen.h
+ * @brief This header file defines the sets of the questions a player has seen in a category, which the sampler
+ *        skips so regulars don't get the same questions game after game. A set keeps the ids of the last games
+ *        in two generations, the older one is dropped when the newer one is full, so it stays bounded whatever
+ *        the size of the bank. It is saved as its sorted ids delta & varint encoded (a compressed sparse bitmap).
+**/
+#ifndef SEEN_H
+#define SEEN_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits of the sets of seen questions
+typedef enum SEEN_SIZES {
+    SEEN_MAX      = 0x00000400, //? Ids kept in a set, both generations together
+    SEEN_SLOTS    = 0x00001000, //? Slots of the hash of a set, a power of two, room for the ids of a long game too
+    SEEN_BLOB     = 0x00001410, //? Bytes of a saved set at most, 5 per id & the 2 counts
+} seensizes_t;
+
+// TODO : Struct for holding a set of seen question ids, ids start at 1 as 0 marks an empty slot
+typedef struct SEEN {
+    uint32_t slots[SEEN_SLOTS];     //? Open addressing hash of the ids, for the lookups of the sampler
+    uint32_t ids[SEEN_MAX];         //? The older generation first, then the newer one
+    uint32_t older;                 //? Ids of the older generation
+    uint32_t count;
+    uint32_t marked;                //? Ids only in the hash, ie: the questions already drawn in a game
+} seen_t;
+
+void   seen_clear(seen_t *);
+bool   seen_has(const seen_t *, uint32_t);
+void   seen_add(seen_t *, uint32_t, uint32_t);
+bool   seen_mark(seen_t *, uint32_t);
+bool   seen_load(seen_t *, const void *, size_t);
+size_t seen_save(const seen_t *, uint8_t *, size_t);
+
+#endif //SEEN_H
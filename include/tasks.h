@@ -0,0 +1,43 @@
+/**
+ * @file tasks.h
+ * @brief This header file defines the background tasks of the game. A task runs blocking work
+ *        (hashing, database queries) on its own thread, reports its progress, & wakes the event loop
+ *        when it progresses or completes, so the loaders follow the real work.
+**/
+#ifndef TASKS_H
+#define TASKS_H
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// TODO : Progress values of a task
+typedef enum TASK_PROGRESS {
+    TASK_STARTED  = 0x00000000,
+    TASK_FINISHED = 0x00000064, //? Percent
+} tprogress_t;
+
+typedef struct TASK task_t;
+
+// TODO : The work of a task, it runs on the thread of the task & returns whether it succeeded
+typedef bool (*task_fn)(task_t *, void *);
+
+// TODO : Struct for holding the state of a background task
+struct TASK {
+    pthread_t        thread;
+    task_fn          work;
+    void            *context;
+    atomic_uint      progress;  //? Percent of the work done
+    atomic_bool      done;
+    bool             result;
+    bool             started;   //? false if the thread couldn't be created, the work then ran inline
+};
+
+bool task_start(task_t *, task_fn, void *);
+void task_progress(task_t *, uint32_t);
+bool task_done(task_t *);
+bool task_wait(task_t *);
+
+#endif //TASKS_H
@@ -0,0 +1,28 @@
+/**
+ * @file template.h
+ * @brief This header file defines the screen templates of the game. The static part of a screen (box, banner,
+ *        header, footer & menu text) is drawn once, kept as a snapshot of the canvas keyed by a hash of what
+ *        it was drawn from, & blitted back on the next frames, so navigating a menu only patches its highlight.
+ *        The canvas has a fixed size, so the templates stay valid when the terminal is resized.
+**/
+#ifndef TEMPLATE_H
+#define TEMPLATE_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits of the template cache
+typedef enum TEMPLATE_SIZES {
+    TEMPLATE_SLOTS = 0x00000008, //? Templates kept, the least recently used one is replaced
+} tsizes_t;
+
+uint64_t template_hash(uint64_t, const void *, size_t);
+uint64_t template_hash_str(uint64_t, const char *);
+
+bool template_load(uint64_t);
+void template_store(uint64_t);
+void template_shutdown(void);
+
+#endif //TEMPLATE_H
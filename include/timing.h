@@ -0,0 +1,31 @@
+/**
+ * @file timing.h
+ * @brief This header file defines the timing of the games. Times are read from the monotonic clock, so the time
+ *        a player spends thinking is counted (unlike the CPU time of clock()) & a change of the system time
+ *        doesn't skew it. The time taken on each question & on the whole game is shared by the stats & bonuses.
+**/
+#ifndef TIMING_H
+#define TIMING_H
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// TODO : Struct for holding the timing of a game, in nanoseconds of the monotonic clock
+typedef struct GAME_TIMING {
+    uint64_t started;
+    uint64_t shown;         //? When the current question was shown
+    uint64_t elapsed;       //? Length of the game, once it is stopped
+    uint64_t answering;     //? Time spent on the questions only, without the screens in between
+    size_t   answered;      //? Questions answered or skipped
+} gtiming_t;
+
+uint64_t timing_now(void);
+void     timing_start(gtiming_t *);
+void     timing_shown(gtiming_t *);
+uint32_t timing_answered(gtiming_t *);
+void     timing_stop(gtiming_t *);
+double   timing_seconds(const gtiming_t *);
+uint32_t timing_ms(uint64_t);
+
+#endif //TIMING_H
@@ -10,6 +10,7 @@
 
 #include <math.h>
 #include <time.h>
+#include <poll.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <ctype.h>
@@ -32,6 +33,9 @@
 #include "console.h"
 #include "global.h"
 #include "emojis.h"
+#include "palette.h"
+#include "tasks.h"
+#include "logger.h"
 
 #define MEMCHECH_LOGS "../logs/memcheck.txt"
 #define ERROR_LOGPATH "../logs/errorlogs.log"
@@ -53,21 +57,20 @@ bool is_login_valid(const char *, const char *);
 bool valid_credentials(const char *, const char *);
 bool regex_match(regex_t *, const char *, const char *);
 
-uint8_t rgb_256(RGB_t);
 char *get_current_datetime(void);
 char *sha256_hashpass(const char *);
 ssize_t input(const char *, char *, size_t);
 ssize_t get_pass(const char *, char *, size_t);
 
 void progress_bar(size_t, size_t);
-void display_help(int, pstats_t *);
-void display_loader(int, int, const char *);
-void display_progress_bar(int, int, const char *);
+bool display_loader(int, int, const char *, task_t *);
+bool display_progress_bar(int, int, const char *, task_t *);
 
 void display_footer(int);
 void display_header(int, const char *, pstats_t *);
-void display_banner(const RGBset_t *, const char *);
+void display_banner(const themes_t *, const char *);
 void print_menu(int, int, size_t, size_t, char [][BADGE_SIZE], char [][BUF_SIZE]);
+void print_menu_item(int, int, size_t, int, char [][BADGE_SIZE], char [][BUF_SIZE]);
 void display_main_page(int, size_t, size_t, pstats_t *, const char *, const char *, char [][BADGE_SIZE], char [][BUF_SIZE]);
 
 void print(const char *,...) __attribute__((format(printf, 1, 2)));
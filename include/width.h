@@ -0,0 +1,30 @@
+/**
+ * @file width.h
+ * @brief This header file defines the display width engine of the game. The number of terminal columns
+ *        of UTF-8 text is computed from precomputed East Asian Width & zero width tables (emoji included),
+ *        with a fast path for runs of ASCII, so the screens center, truncate & align text by columns
+ *        instead of bytes.
+**/
+#ifndef WIDTH_H
+#define WIDTH_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// TODO : Alignments of the text written into a fixed number of columns
+typedef enum WIDTH_ALIGN {
+    ALIGN_LEFT    = 0x00000000,
+    ALIGN_RIGHT   = 0x00000001,
+    ALIGN_CENTER  = 0x00000002,
+} walign_t;
+
+int    width_codepoint(uint32_t);
+size_t width_decode(const char *, size_t, uint32_t *);
+size_t width_text(const char *, size_t);
+size_t width_str(const char *);
+size_t width_fit(const char *, size_t, size_t, size_t *);
+int    width_center(const char *, size_t);
+size_t width_pad(char *, size_t, const char *, size_t, walign_t);
+
+#endif //WIDTH_H
@@ -0,0 +1,39 @@
+/**
+ * @file wrap.h
+ * @brief This header file defines the text wrapping engine of the game. Text is word-wrapped to a number of
+ *        display columns, & the wrapped lines of the questions & choices are cached by their id & width,
+ *        so redrawing a screen never wraps the same text twice.
+**/
+#ifndef WRAP_H
+#define WRAP_H
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// TODO : Limits of the wrapping engine
+typedef enum WRAP_SIZES {
+    WRAP_LINES    = 0x00000010, //? Lines kept per text, the rest is clipped
+    WRAP_CACHE    = 0x00000080, //? Slots of the cache, a power of two
+} wsizes_t;
+
+// TODO : A wrapped line, as a slice of the text it was wrapped from
+typedef struct WRAP_LINE {
+    uint16_t start;
+    uint16_t len;
+} wline_t;
+
+// TODO : Struct for holding the wrapped lines of a text
+typedef struct WRAPPED_TEXT {
+    size_t  count;
+    size_t  width;              //? Columns the text was wrapped to
+    bool    clipped;            //? The text didn't fit in WRAP_LINES lines
+    wline_t lines[WRAP_LINES];
+} wrapped_t;
+
+size_t           wrap_text(const char *, size_t, wrapped_t *);
+const wrapped_t *wrap_cached(int, const char *, size_t);
+size_t           wrap_print(int, int, int, const char *, const wrapped_t *, size_t);
+
+#endif //WRAP_H
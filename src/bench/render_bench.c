@@ -0,0 +1,242 @@
+#include <poll.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "../../include/db.h"
+#include "../../include/console.h"
+#include "../../include/output.h"
+#include "../../include/layout.h"
+#include "../../include/scene.h"
+
+
+// TODO : Constants of the render benchmark
+typedef enum BENCH_SIZES {
+    BENCH_IDLE_MS  = 0x00000028, //? Quiet time of a screen before the next key is typed on it
+    BENCH_WAIT_MS  = 0x00002710, //? Longest quiet time before a screen is taken for stuck
+    BENCH_DRAIN    = 0x00004000,
+    BENCH_SEED     = 0x00000001, //? Seed of the games played by the benchmark, so runs draw the same questions
+} bsizes_t;
+
+// TODO : A screen driven by the benchmark, with the keys typed on it one after the other
+typedef struct BENCH_SCREEN {
+    const char  *file;
+    const char  *name;
+    scenes_t     scene;
+    const char  *keys[0x10];   //? NULL terminated
+} bscreen_t;
+
+// TODO : Struct for holding what a screen cost, sent back by the child process that drove it
+typedef struct BENCH_RESULT {
+    ostats_t stats;
+    uint64_t cpu_us;            //? User + system CPU time of the child, drawing included
+} bresult_t;
+
+static int      result_fd = -1;
+static ostats_t baseline;      //? Counters of the child before the screen ran, inherited from the parent
+
+#define DOWN  "\033[B"
+#define UP    "\033[A"
+#define RIGHT "\033[C"
+#define LEFT  "\033[D"
+
+
+static const bscreen_t SCREENS[] = {
+    {"gamecore.c", "homepage",           SCENE_HOMEPAGE,       {DOWN, RIGHT, UP, LEFT, DOWN, UP, NULL}},
+    {"gamecore.c", "mainmenu",           SCENE_MAINMENU,       {DOWN, RIGHT, UP, LEFT, DOWN, UP, NULL}},
+    {"gamecore.c", "settings",           SCENE_SETTINGS,       {DOWN, RIGHT, UP, LEFT, DOWN, UP, NULL}},
+    {"gamecore.c", "gameplay",           SCENE_GAMEPLAY,       {DOWN, RIGHT, UP, LEFT, DOWN, UP, NULL}},
+    {"gamecore.c", "guestplayer_mode",   SCENE_GUEST_MODE,     {DOWN, RIGHT, UP, LEFT, DOWN, UP, NULL}},
+    {"gamecore.c", "display_help",       SCENE_HELP,           {"x", DOWN, UP, NULL}},
+    {"gamecore.c", "display_scoreboard", SCENE_SCOREBOARD,     {"x", DOWN, UP, NULL}},
+    {"gamecore.c", "display_gamestats",  SCENE_GAMESTATS,      {"x", DOWN, UP, NULL}},
+    {"account.c",  "login",              SCENE_LOGIN,          {"johndoe_11\n", "Avjohn12345$\n", "x", DOWN, UP, NULL}},
+    {"account.c",  "signup",             SCENE_SIGNUP,         {"John\n", "Doe\n", "john", NULL}},
+    {"account.c",  "manage_account",     SCENE_MANAGE_ACCOUNT, {DOWN, RIGHT, UP, LEFT, DOWN, UP, NULL}},
+    {"gameplay.c", "display_questions",  SCENE_QUESTIONS,      {"A", "B", "C", "D", "S", "A", NULL}},
+    {"gameplay.c", "play_as_guest",      SCENE_GUEST_GAME,     {"A", "B", "C", "D", "S", "A", NULL}},
+};
+
+
+/**
+ * @brief This function is called in the child process when the parent is done typing keys on the screen.
+ *        The child is blocked on a key press by then, so the counters are consistent. Only async-signal-safe
+ *        calls are made, & the child leaves without drawing the exit screen so it isn't counted.
+ *
+ * @param sig no use
+ */
+static void report_and_exit(const int sig) {
+    (void)sig;
+    bresult_t result = {0};
+    out_stats(&result.stats);
+    result.stats.frames -= baseline.frames;
+    result.stats.totalBytes -= baseline.totalBytes;
+    result.stats.totalSyscalls -= baseline.totalSyscalls;
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        result.cpu_us = (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000U +
+                        (uint64_t)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+    }
+    if (write(result_fd, &result, sizeof(result)) != (ssize_t)sizeof(result)) {
+        _exit(EXIT_FAILURE);
+    }
+    _exit(EXIT_SUCCESS);
+}
+
+
+/**
+ * @brief This function runs a screen in the child process, reading its keys from 'keys_fd'
+ *        & presenting its frames to 'out_fd' through the given target
+ */
+static void run_child(const bscreen_t *screen, const pstats_t *player, const rtargets_t target,
+                      const int keys_fd, const int out_fd) {
+    struct sigaction action = {0};
+    action.sa_handler = report_and_exit;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGUSR1, &action, NULL);
+
+    if (dup2(keys_fd, STDIN_FILENO) == VALUE_ERROR || dup2(out_fd, STDOUT_FILENO) == VALUE_ERROR) {
+        _exit(EXIT_FAILURE);
+    }
+    close(keys_fd);
+    close(out_fd);
+
+    initialize_headless(target);
+    out_stats(&baseline);
+    //? The screen is the only scene on the stack, a screen going back leaves the child waiting for the report
+    session_t session = {.box_offset = layout_box_offset(), .player = *player, .category = "SCIENCE", .mode = EDITACCOUNT};
+    //? Every run draws the same questions, unless QUIZBIT_SEED picks others
+    if (!rng_init(&session.rng)) {
+        rng_seed(&session.rng, BENCH_SEED);
+    }
+    scene_run(&session, screen->scene);
+    for (;;) {
+        pause();
+    }
+}
+
+
+/**
+ * @brief This function drains what the child writes to the terminal until it has been quiet for a while,
+ *        ie: until it waits for a key press. A screen that never gets quiet is left after BENCH_WAIT_MS.
+ *
+ * @param fd The read end of the output of the child
+ */
+static void wait_quiet(const int fd) {
+    char buffer[BENCH_DRAIN];
+    struct pollfd pfd = {.fd = fd, .events = POLLIN, .revents = 0};
+
+    for (int waited = 0; waited < BENCH_WAIT_MS; waited += BENCH_IDLE_MS) {
+        if (poll(&pfd, 1, BENCH_IDLE_MS) <= 0 || read(fd, buffer, sizeof(buffer)) <= 0) {
+            return;
+        }
+    }
+}
+
+
+/**
+ * @brief This function drives a screen in a child process: every key is typed once the screen has been quiet
+ *        for a while, so the frames aren't coalesced, then the counters of the child are collected
+ *
+ * @returns true if the result was collected, otherwise false
+ */
+static bool bench_screen(const bscreen_t *screen, const pstats_t *player, const rtargets_t target, bresult_t *result) {
+    int keys[2], out[2], res[2];
+    if (pipe(keys) == VALUE_ERROR || pipe(out) == VALUE_ERROR || pipe(res) == VALUE_ERROR) {
+        perror("pipe");
+        return false;
+    }
+
+    const pid_t pid = fork();
+    if (pid == VALUE_ERROR) {
+        perror("fork");
+        return false;
+    }
+    if (pid == 0) {
+        close(keys[1]);
+        close(out[0]);
+        close(res[0]);
+        result_fd = res[1];
+        run_child(screen, player, target, keys[0], out[1]);
+    }
+    close(keys[0]);
+    close(out[1]);
+    close(res[1]);
+
+    bool ok = true;
+    const size_t max_keys = sizeof(screen->keys) / sizeof(screen->keys[0]);
+    for (size_t i = 0; ok; i++) {
+        wait_quiet(out[0]);
+        if (i == max_keys || screen->keys[i] == NULL) {
+            break;
+        }
+        const size_t len = strlen(screen->keys[i]);
+        ok = write(keys[1], screen->keys[i], len) == (ssize_t)len;
+    }
+
+    kill(pid, SIGUSR1);
+    wait_quiet(out[0]);
+
+    ok = ok && read(res[0], result, sizeof(*result)) == (ssize_t)sizeof(*result);
+    waitpid(pid, NULL, 0);
+
+    close(keys[1]);
+    close(out[0]);
+    close(res[0]);
+    return ok;
+}
+
+
+/**
+ * @brief The render benchmark. Every screen of gamecore.c, account.c & gameplay.c is driven headlessly
+ *        with a few keys, & the bytes & syscalls per frame it cost are printed. The 'memory' target counts
+ *        the bytes without writing them, the 'null' target doesn't present the frames at all, so what is
+ *        left of the CPU time is the drawing. It is run from the build directory, like the game, against
+ *        the game database, which the screens only read.
+ *
+ *        ./render_bench [terminal|memory|null]
+ *
+ * @return Exit Status Code ie: EXIT_SUCCESS '0' or EXIT_FAILURE '1'
+ */
+int main(const int argc, char *argv[]) {
+    rtargets_t target = TARGET_TERMINAL;
+    if (argc > 1 && strcmp(argv[1], "memory") == 0) {
+        target = TARGET_MEMORY;
+    }
+    else if (argc > 1 && strcmp(argv[1], "null") == 0) {
+        target = TARGET_NULL;
+    }
+    else if (argc > 1 && strcmp(argv[1], "terminal") != 0) {
+        fprintf(stderr, "Usage: %s [terminal|memory|null]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!setup()) {
+        return EXIT_FAILURE;
+    }
+    if (setlocale(LC_ALL, "en_US.UTF-8") == NULL) {
+        setlocale(LC_ALL, "C.UTF-8");
+    }
+
+    pstats_t player = {0};
+    if (!get_player_data("johndoe_11", &player)) {
+        fprintf(stderr, "The demo player 'johndoe_11' is missing from %s\n", DBFILEPATH);
+        return EXIT_FAILURE;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("%-11s %-19s %7s %12s %15s %10s\n", "FILE", "SCREEN", "FRAMES", "BYTES/FRAME", "SYSCALLS/FRAME", "CPU MS");
+    for (size_t i = 0; i < sizeof(SCREENS) / sizeof(SCREENS[0]); i++) {
+        bresult_t result;
+        if (!bench_screen(&SCREENS[i], &player, target, &result)) {
+            printf("%-11s %-19s %7s\n", SCREENS[i].file, SCREENS[i].name, "failed");
+            continue;
+        }
+        const double frames = result.stats.frames > 0 ? (double)result.stats.frames : 1.0;
+        printf("%-11s %-19s %7llu %12.1f %15.2f %10.2f\n", SCREENS[i].file, SCREENS[i].name,
+               (unsigned long long)result.stats.frames, (double)result.stats.totalBytes / frames,
+               (double)result.stats.totalSyscalls / frames, (double)result.cpu_us / 1000.0);
+        fflush(stdout);
+    }
+    return EXIT_SUCCESS;
+}
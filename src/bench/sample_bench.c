@@ -0,0 +1,160 @@
+#include <inttypes.h>
+
+#include "../../include/db.h"
+
+
+// TODO : Constants of the sampler benchmark
+typedef enum SAMPLE_BENCH_SIZES {
+    SBENCH_GAMES  = 0x000000C8, //? Games drawn per bank
+    SBENCH_ROWS   = 0x00000400, //? Rows a game may read at most, whatever the size of the bank
+    SBENCH_SEED   = 0x00000001,
+} sbsizes_t;
+
+// TODO : A bank of questions the games are drawn from, with the share of its questions the player has seen
+typedef struct SAMPLE_BANK {
+    const char *name;
+    uint32_t    count;      //? Questions of the bank
+    uint32_t    step;       //? Gap between two ids, the ids are sparse above 1
+    uint32_t    seen;       //? Percent of the questions seen by the player
+    bool        clustered;  //? The seen questions are the lowest ids, otherwise they are spread over the bank
+    bool        unseen;     //? Every question drawn must be unseen, the bank has enough of them within reach
+} sbank_t;
+
+static const sbank_t BANKS[] = {
+    {"dense, unseen",        0x00000FA0, 1,    0,  false, true},
+    {"dense, 75% seen",      0x00000190, 1,    75, false, true},
+    {"dense x10, 75% seen",  0x00000FA0, 1,    75, false, true},
+    {"sparse, 75% seen",     0x00000FA0, 0x40, 75, false, true},
+    {"sparse, 75% in a row", 0x00000FA0, 0x40, 75, true,  false},
+    {"small, 90% seen",      0x00000032, 1,    90, false, false},
+};
+
+
+/**
+ * @brief This function counts the rows read by the statements of the connection
+ */
+static int count_rows(const unsigned type, void *context, void *stmt, void *unused) {
+    (void)type, (void)stmt, (void)unused;
+    *(uint64_t *)context += 1;
+    return 0;
+}
+
+
+/**
+ * @brief This function creates a bank of questions in the database
+ *
+ * @param db A pointer to the SQLite3 database connection.
+ * @param bank A pointer to the bank
+ *
+ * @returns true if the bank is created, otherwise false
+ */
+static bool create_bank(sqlite3 *db, const sbank_t *bank) {
+    const char *sqlQUERY =
+        "DROP TABLE IF EXISTS BENCH;"
+        "CREATE TABLE BENCH (question_id INTEGER PRIMARY KEY, question TEXT NOT NULL, choice_a TEXT NOT NULL,"
+        "choice_b TEXT NOT NULL, choice_c TEXT NOT NULL, choice_d TEXT NOT NULL, correct INTEGER NOT NULL);";
+    if (sqlite3_exec(db, sqlQUERY, NULL, NULL, NULL) != SQLITE_OK) {
+        return false;
+    }
+
+    sqlite3_stmt *stmt = NULL;
+    const char *insertQUERY = "INSERT INTO BENCH VALUES (?, 'Question?', 'One', 'Two', 'Three', 'Four', 0);";
+    bool ret = sqlite3_exec(db, "BEGIN;", NULL, NULL, NULL) == SQLITE_OK &&
+               sqlite3_prepare_v3(db, insertQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) == SQLITE_OK;
+    for (uint32_t i = 0; ret && i < bank->count; i++) {
+        ret = sqlite3_bind_int(stmt, 1, (int)(1 + i * bank->step)) == SQLITE_OK &&
+              sqlite3_step(stmt) == SQLITE_DONE &&
+              sqlite3_reset(stmt) == SQLITE_OK;
+    }
+    sqlite3_finalize(stmt);
+    return ret && sqlite3_exec(db, "COMMIT;", NULL, NULL, NULL) == SQLITE_OK;
+}
+
+
+/**
+ * @brief This function draws games from a bank & checks that they are drawn without repeats, from the unseen
+ *        questions first, & read a bounded number of rows whatever the size of the bank.
+ *
+ * @param db A pointer to the SQLite3 database connection.
+ * @param bank A pointer to the bank
+ * @param rows A pointer to the rows read by the statements of the connection
+ *
+ * @returns true if every game passed, otherwise false
+ */
+static bool bench_bank(sqlite3 *db, const sbank_t *bank, uint64_t *rows) {
+    seen_t *base = malloc(sizeof(seen_t));
+    seen_t *seen = malloc(sizeof(seen_t));
+    if (base == NULL || seen == NULL || !create_bank(db, bank)) {
+        free(base);
+        free(seen);
+        return false;
+    }
+    seen_clear(base);
+    for (uint32_t i = 0; i < bank->count; i++) {
+        //? A spread set is scattered by a hash, like the ids the sampler draws
+        if (bank->clustered ? i < bank->count / 100 * bank->seen : (i * 0x9E3779B1U >> 16) % 100 < bank->seen) {
+            seen_mark(base, 1 + i * bank->step);
+        }
+    }
+
+    rng_t rng;
+    rng_seed(&rng, SBENCH_SEED);
+    quiz_t questions[MAX_QUESTIONS];
+    uint64_t total = 0, worst = 0, repeats = 0, stale = 0;
+
+    const uint64_t started = timing_now();
+    bool ret = true;
+    for (size_t game = 0; ret && game < SBENCH_GAMES; game++) {
+        memcpy(seen, base, sizeof(seen_t));
+        const uint64_t before = *rows;
+        ret = get_questions(db, questions, "BENCH", MAX_QUESTIONS, &rng, seen, NULL);
+        const uint64_t read = *rows - before;
+        total += read;
+        worst = read > worst ? read : worst;
+
+        for (size_t i = 0; ret && i < MAX_QUESTIONS; i++) {
+            for (size_t j = 0; j < i; j++) {
+                repeats += questions[i].question_id == questions[j].question_id;
+            }
+            stale += seen_has(base, (uint32_t)questions[i].question_id);
+        }
+    }
+    const uint64_t elapsed = timing_now() - started;
+
+    printf("%-20s %6u %5u%% %9.1f %9" PRIu64 " %9.1f %7" PRIu64 " %7" PRIu64 "\n", bank->name, bank->count,
+           bank->seen, (double)total / SBENCH_GAMES, worst,
+           (double)elapsed / 1e3 / SBENCH_GAMES, repeats, stale);
+
+    free(base);
+    free(seen);
+    return ret && worst <= SBENCH_ROWS && repeats == 0 && (!bank->unseen || stale == 0);
+}
+
+
+/**
+ * @brief The sampler benchmark, run by ctest. It draws games from banks of questions the player has mostly seen,
+ *        & fails if a game reads more than SBENCH_ROWS rows, repeats a question, or draws a seen question
+ *        from a bank with enough unseen ones.
+ */
+int main(void) {
+    sqlite3 *db = NULL;
+    if (sqlite3_open(":memory:", &db) != SQLITE_OK) {
+        fprintf(stderr, "Error opening db : %s\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return EXIT_FAILURE;
+    }
+    uint64_t rows = 0;
+    sqlite3_trace_v2(db, SQLITE_TRACE_ROW, count_rows, &rows);
+
+    printf("%-20s %6s %6s %9s %9s %9s %7s %7s\n", "BANK", "SIZE", "SEEN", "ROWS/GAME", "MAX ROWS", "US/GAME",
+           "REPEATS", "STALE");
+    bool ret = true;
+    for (size_t i = 0; i < sizeof(BANKS) / sizeof(BANKS[0]); i++) {
+        if (!bench_bank(db, &BANKS[i], &rows)) {
+            fprintf(stderr, "FAILED : %s\n", BANKS[i].name);
+            ret = false;
+        }
+    }
+    sqlite3_close(db);
+    return ret ? EXIT_SUCCESS : EXIT_FAILURE;
+}
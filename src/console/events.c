@@ -0,0 +1,287 @@
+#include "../../include/events.h"
+#include "../../include/input.h"
+#include "../../include/render.h"
+#include "../../include/utilities.h"
+
+
+// TODO : A timer of the event loop
+typedef struct EVENT_TIMER {
+    uint64_t deadline;   //? CLOCK_MONOTONIC milliseconds
+    uint32_t interval;
+    bool     repeat;
+    bool     active;
+    timer_cb callback;
+    void    *context;
+} etimer_t;
+
+// TODO : State of the event loop
+static struct EVENT_LOOP {
+    bool      ready;
+    bool      eof;                   //? stdin was closed
+    int       pipefd[2];             //? Self-pipe, the signal handlers write the signal number into it
+    signal_cb handlers[NSIG];
+    etimer_t  timers[MAX_TIMERS];
+} loop = {.pipefd = {-1, -1}};
+
+
+/**
+ * @returns The current time of the monotonic clock in milliseconds
+ */
+uint64_t events_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+
+/**
+ * @brief This function wakes the event loop from another thread (ie: a background task progressed),
+ *        so the screen waiting on it is redrawn
+ */
+void events_wake(void) {
+    if (!loop.ready) {
+        return;
+    }
+    const unsigned char byte = WAKE_EVENT;
+    if (write(loop.pipefd[1], &byte, 1) < 0) {}
+}
+
+
+/**
+ * @brief This function is the handler installed for the forwarded signals. It only writes the signal number
+ *        into the self-pipe, which is async-signal-safe, the registered handler runs later in the loop.
+ *
+ * @param sig The signal received
+ */
+static void forward_signal(const int sig) {
+    const int saved = errno;
+    const unsigned char byte = (unsigned char)sig;
+    //? A full pipe already holds pending signals, dropping the byte is harmless
+    if (write(loop.pipefd[1], &byte, 1) < 0) {}
+    errno = saved;
+}
+
+
+/**
+ * @brief This function creates the self-pipe of the event loop
+ *
+ * @returns true if the event loop is ready, otherwise false
+ */
+bool events_init(void) {
+    if (loop.ready) {
+        return true;
+    }
+    if (pipe(loop.pipefd) == VALUE_ERROR) {
+        log_error(__func__, __FILE__, __LINE__, "pipe() : %s\n", strerror(errno));
+        return false;
+    }
+    for (int i = 0; i < 2; i++) {
+        fcntl(loop.pipefd[i], F_SETFL, fcntl(loop.pipefd[i], F_GETFL) | O_NONBLOCK);
+        fcntl(loop.pipefd[i], F_SETFD, FD_CLOEXEC);
+    }
+    loop.ready = true;
+    return true;
+}
+
+
+/**
+ * @brief This function forwards a signal through the event loop, its handler then runs outside of
+ *        the signal context, where it can safely log, draw & exit.
+ *
+ * @param sig The signal to forward
+ * @param handler The function called by the loop when the signal is received
+ *
+ * @returns true if the signal is forwarded, otherwise false
+ */
+bool events_handle_signal(const int sig, const signal_cb handler) {
+    if (sig <= 0 || sig >= NSIG || !events_init()) {
+        return false;
+    }
+    loop.handlers[sig] = handler;
+
+    struct sigaction sa;
+    sa.sa_handler = forward_signal;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    return sigaction(sig, &sa, NULL) == VALUE_SUCCESS;
+}
+
+
+/**
+ * @brief This function starts a timer
+ *
+ * @param interval Milliseconds until the timer fires
+ * @param repeat true to fire every 'interval' milliseconds until it is cancelled
+ * @param callback The function called when the timer fires
+ * @param context A pointer passed to the callback
+ *
+ * @returns The id of the timer, or NO_TIMER if every timer slot is taken
+ */
+int events_add_timer(const uint32_t interval, const bool repeat, const timer_cb callback, void *context) {
+    for (int id = 0; id < MAX_TIMERS; id++) {
+        if (!loop.timers[id].active) {
+            loop.timers[id] = (etimer_t){
+                .deadline = events_now() + interval, .interval = interval, .repeat = repeat,
+                .active = true, .callback = callback, .context = context
+            };
+            return id;
+        }
+    }
+    log_error(__func__, __FILE__, __LINE__, "No free timer slot!...\n");
+    return NO_TIMER;
+}
+
+
+/**
+ * @param id The id of the timer to stop
+ */
+void events_cancel_timer(const int id) {
+    if (id >= 0 && id < MAX_TIMERS) {
+        loop.timers[id].active = false;
+    }
+}
+
+
+/**
+ * @brief This function calls the callbacks of the timers that are due. A repeating timer keeps its cadence,
+ *        unless it fell more than one interval behind.
+ *
+ * @returns true if a timer fired, otherwise false
+ */
+static bool fire_timers(void) {
+    bool fired = false;
+    const uint64_t now = events_now();
+
+    for (int id = 0; id < MAX_TIMERS; id++) {
+        etimer_t *timer = &loop.timers[id];
+        if (!timer->active || timer->deadline > now) {
+            continue;
+        }
+        if (timer->repeat) {
+            timer->deadline += timer->interval;
+            if (timer->deadline <= now) {
+                timer->deadline = now + timer->interval;
+            }
+        }
+        else {
+            timer->active = false;
+        }
+        timer->callback(timer->context);
+        fired = true;
+    }
+    return fired;
+}
+
+
+/**
+ * @brief This function computes how long the loop may sleep before the next timer is due
+ *
+ * @param timeout The longest wait requested by the caller, -1 for no limit
+ *
+ * @returns The poll timeout in milliseconds
+ */
+static int next_timeout(const int timeout) {
+    int wait = timeout;
+    const uint64_t now = events_now();
+
+    for (int id = 0; id < MAX_TIMERS; id++) {
+        const etimer_t *timer = &loop.timers[id];
+        if (!timer->active) {
+            continue;
+        }
+        const int due = timer->deadline > now ? (int)(timer->deadline - now) : 0;
+        if (wait < 0 || due < wait) {
+            wait = due;
+        }
+    }
+    return wait;
+}
+
+
+/**
+ * @brief This function calls the handlers of the signals written into the self-pipe
+ */
+static void dispatch_signals(void) {
+    unsigned char sigs[BUF_SIZE];
+    ssize_t n;
+    while ((n = read(loop.pipefd[0], sigs, sizeof(sigs))) > 0) {
+        for (ssize_t i = 0; i < n; i++) {
+            if (sigs[i] != WAKE_EVENT && sigs[i] < NSIG && loop.handlers[sigs[i]] != NULL) {
+                loop.handlers[sigs[i]](sigs[i]);
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief This function waits for one round of events: input is read into the ring buffer of the input layer,
+ *        forwarded signals are handled, & due timers fire. The frame is presented if a timer drew into it.
+ *
+ * @param timeout The longest wait in milliseconds, -1 to wait until an event arrives
+ */
+void events_run_once(const int timeout) {
+    struct pollfd pfds[2] = {
+        //? A negative fd is ignored by poll, stdin isn't watched while the ring buffer is full or closed
+        {.fd = input_full() || loop.eof ? -1 : STDIN_FILENO, .events = POLLIN},
+        {.fd = loop.ready ? loop.pipefd[0] : -1, .events = POLLIN}
+    };
+
+    const int ready = poll(pfds, 2, next_timeout(timeout));
+    if (ready > 0) {
+        if (pfds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            loop.eof = input_read() <= 0 && !input_full();
+        }
+        if (pfds[1].revents & POLLIN) {
+            dispatch_signals();
+        }
+    }
+    else if (ready < 0 && errno != EINTR) {
+        log_error(__func__, __FILE__, __LINE__, "poll() : %s\n", strerror(errno));
+    }
+
+    if (fire_timers()) {
+        render_present();
+    }
+}
+
+
+/**
+ * @brief This function runs the event loop until a flag is set by a callback
+ *
+ * @param done A pointer to the flag
+ */
+void events_run_until(const volatile bool *done) {
+    while (!*done) {
+        events_run_once(WAIT_FOREVER);
+    }
+}
+
+
+/**
+ * @brief This function runs the event loop for the given time, keys pressed meanwhile stay in the ring buffer
+ *
+ * @param milliseconds The time to wait
+ */
+void events_sleep(const uint32_t milliseconds) {
+    const uint64_t deadline = events_now() + milliseconds;
+    for (uint64_t now = events_now(); now < deadline; now = events_now()) {
+        events_run_once((int)(deadline - now));
+    }
+}
+
+
+/**
+ * @brief This function runs the event loop until a key press is in the ring buffer of the input layer
+ *
+ * @returns The first byte of the key press, or INPUT_EOF if stdin is closed
+ */
+int events_wait_key(void) {
+    while (!input_pending()) {
+        if (loop.eof) {
+            return INPUT_EOF;
+        }
+        events_run_once(WAIT_FOREVER);
+    }
+    return input_getc();
+}
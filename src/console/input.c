@@ -0,0 +1,178 @@
+#include "../../include/input.h"
+#include "../../include/console.h"
+#include "../../include/utilities.h"
+
+
+// TODO : State of the input layer, 'head' & 'tail' only grow, their difference is the number of buffered bytes
+static struct INPUT_STATE {
+    unsigned char data[INPUT_RING];
+    size_t        head;   //? Next byte to consume
+    size_t        tail;   //? Next free slot
+    bool          raw;    //? The terminal is in non-canonical mode
+} in;
+
+
+/**
+ * @brief This function switches the terminal to non-canonical mode without echo, once for the whole game.
+ *        Signals (CTRL+C) & the translation of '\r' to '\n' are kept.
+ *        The attributes saved by 'initialize_terminal' are restored by 'input_restore'.
+ *
+ * @returns true if the terminal is in non-canonical mode, otherwise false
+ */
+bool input_init(void) {
+    if (!isatty(STDIN_FILENO)) {
+        return false;
+    }
+
+    struct termios raw_tio = default_term_attr;
+    raw_tio.c_lflag &= ~(ICANON | ECHO);
+    raw_tio.c_cc[VMIN] = 1;
+    raw_tio.c_cc[VTIME] = 0;
+    if (tcsetattr(STDIN_FILENO, TCSANOW, &raw_tio) == VALUE_ERROR) {
+        log_error(__func__, __FILE__, __LINE__, "tcsetattr() : %s\n", strerror(errno));
+        return false;
+    }
+    in.raw = true;
+    return true;
+}
+
+
+/**
+ * @brief This function restores the attributes the terminal had at the start of the program
+ */
+void input_restore(void) {
+    if (in.raw) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &default_term_attr);
+        in.raw = false;
+    }
+}
+
+
+/**
+ * @brief This function reads the bytes available on stdin into the free space of the ring buffer.
+ *        It blocks unless stdin was reported readable (ie: by poll).
+ *
+ * @returns The number of bytes read, 0 if stdin is closed, or -1 if the read fails or the ring buffer is full
+ */
+ssize_t input_read(void) {
+    const size_t used = in.tail - in.head;
+    if (used == INPUT_RING) {
+        return VALUE_ERROR;
+    }
+
+    //? Read up to the end of the storage, the wrapped part is picked up by the next read
+    const size_t start = in.tail % INPUT_RING;
+    size_t room = INPUT_RING - used;
+    if (room > INPUT_RING - start) {
+        room = INPUT_RING - start;
+    }
+
+    ssize_t n;
+    do {
+        n = read(STDIN_FILENO, in.data + start, room);
+    } while (n < 0 && errno == EINTR);
+    if (n > 0) {
+        in.tail += (size_t)n;
+    }
+    return n;
+}
+
+
+/**
+ * @brief This function waits for stdin to be readable, then reads the available bytes into the ring buffer
+ *
+ * @param timeout Milliseconds to wait for input, -1 to wait until input arrives
+ *
+ * @returns The number of bytes read, 0 on timeout, end of file, or a full ring buffer
+ */
+size_t input_fill(const int timeout) {
+    if (input_full()) {
+        return 0;
+    }
+
+    struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN};
+    int ready;
+    do {
+        ready = poll(&pfd, 1, timeout);
+    } while (ready < 0 && errno == EINTR);
+    if (ready <= 0) {
+        return 0;
+    }
+
+    const ssize_t n = input_read();
+    return n > 0 ? (size_t)n : 0;
+}
+
+
+/**
+ * @returns true if the ring buffer has no room for another byte, otherwise false
+ */
+bool input_full(void) {
+    return in.tail - in.head == INPUT_RING;
+}
+
+
+/**
+ * @returns true if bytes are waiting in the ring buffer, otherwise false
+ */
+bool input_pending(void) {
+    return in.tail != in.head;
+}
+
+
+/**
+ * @brief This function consumes one byte from the ring buffer, reading from stdin if it is empty
+ *
+ * @param timeout Milliseconds to wait for input, -1 to wait until input arrives
+ *
+ * @returns The byte read, INPUT_TIMEOUT if no byte arrived in time, or INPUT_EOF if stdin is closed
+ */
+int input_getc_timeout(const int timeout) {
+    if (!input_pending() && input_fill(timeout) == 0) {
+        struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN};
+        //? A readable stdin that returned nothing is closed
+        return poll(&pfd, 1, 0) > 0 ? INPUT_EOF : INPUT_TIMEOUT;
+    }
+    const int c = in.data[in.head % INPUT_RING];
+    in.head += 1;
+    return c;
+}
+
+
+/**
+ * @brief This function puts back the byte consumed last, so a decoder can look ahead without losing it
+ */
+void input_unget(void) {
+    if (in.head != 0) {
+        in.head -= 1;
+    }
+}
+
+
+/**
+ * @brief This function appends bytes read elsewhere (ie: keys typed while the terminal was queried) to the
+ *        ring buffer, so they are consumed as if the input layer had read them. The bytes past its room are dropped.
+ *
+ * @param bytes A pointer to the bytes
+ * @param len The number of bytes
+ */
+void input_push(const char *bytes, const size_t len) {
+    for (size_t i = 0; i < len && !input_full(); i++) {
+        in.data[in.tail % INPUT_RING] = (unsigned char)bytes[i];
+        in.tail += 1;
+    }
+}
+
+
+/**
+ * @brief This function consumes one byte from the ring buffer, waiting for input if it is empty
+ *
+ * @returns The byte read, or INPUT_EOF if stdin is closed
+ */
+int input_getc(void) {
+    int c;
+    do {
+        c = input_getc_timeout(-1);
+    } while (c == INPUT_TIMEOUT);
+    return c;
+}
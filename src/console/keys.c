@@ -0,0 +1,224 @@
+#include "../../include/keys.h"
+#include "../../include/input.h"
+#include "../../include/events.h"
+#include "../../include/crash.h"
+#include "../../include/utilities.h"
+
+
+//? Keys of the sequences ending with a letter, CSI '\033[A' & SS3 '\033OA' share the table
+static const int FINAL_KEYS[0x80] = {
+    ['A'] = UP_KEY,   ['B'] = DOWN_KEY, ['C'] = RIGHT_KEY, ['D'] = LEFT_KEY,
+    ['H'] = HOME_KEY, ['F'] = END_KEY,  ['Z'] = BACKTAB_KEY,
+    ['P'] = F1_KEY,   ['Q'] = F1_KEY + 1, ['R'] = F1_KEY + 2, ['S'] = F1_KEY + 3,
+};
+
+//? Keys of the sequences '\033[<n>~' by their first parameter (VT220 & xterm)
+static const int TILDE_KEYS[] = {
+    [1]  = HOME_KEY,   [2]  = INSERT_KEY, [3]  = DELETE_KEY, [4]  = END_KEY,
+    [5]  = PGUP_KEY,   [6]  = PGDN_KEY,   [7]  = HOME_KEY,   [8]  = END_KEY,
+    [11] = F1_KEY,     [12] = F1_KEY + 1, [13] = F1_KEY + 2, [14] = F1_KEY + 3, [15] = F1_KEY + 4,
+    [17] = F1_KEY + 5, [18] = F1_KEY + 6, [19] = F1_KEY + 7, [20] = F1_KEY + 8, [21] = F1_KEY + 9,
+    [23] = F1_KEY + 10, [24] = F1_KEY + 11,
+};
+
+//? Function keys of the Linux console, '\033[[A' to '\033[[E'
+static const int LINUX_KEYS[] = {F1_KEY, F1_KEY + 1, F1_KEY + 2, F1_KEY + 3, F1_KEY + 4};
+
+//? Sequence closing a bracketed paste
+static const char PASTE_CLOSE[] = "\033[201~";
+
+// TODO : Text of the last bracketed paste
+static struct PASTE_BUFFER {
+    char   data[MAX_PASTE];
+    size_t len;
+} paste;
+
+
+/**
+ * @brief This function reads the next byte of a sequence. Bytes already in the ring buffer are taken
+ *        without a system call, the terminal is only polled when a sequence was split between reads.
+ *
+ * @param timeout Milliseconds to wait for the byte if the ring buffer is empty
+ *
+ * @returns The byte read, INPUT_TIMEOUT if no byte arrived in time, or INPUT_EOF if stdin is closed
+ */
+static int next_byte(const int timeout) {
+    return input_pending() ? input_getc() : input_getc_timeout(timeout);
+}
+
+
+/**
+ * @brief This function stores the text of a bracketed paste up to its closing sequence.
+ *        The text past MAX_PASTE bytes is dropped, the closing sequence is still consumed.
+ */
+static void read_paste(void) {
+    paste.len = 0;
+    size_t matched = 0;
+
+    for (;;) {
+        const int c = next_byte(PROBE_TIMEOUT);
+        if (c < 0) {
+            return;
+        }
+        if (c == (unsigned char)PASTE_CLOSE[matched]) {
+            matched += 1;
+            if (PASTE_CLOSE[matched] == NULL_TERM) {
+                return;
+            }
+            continue;
+        }
+
+        //? A partial match was text, only its first byte (ESC) can start the closing sequence again
+        for (size_t i = 0; i < matched && paste.len < MAX_PASTE; i++) {
+            paste.data[paste.len++] = PASTE_CLOSE[i];
+        }
+        matched = c == ESC_KEY ? 1 : 0;
+        if (matched == 0 && paste.len < MAX_PASTE) {
+            paste.data[paste.len++] = (char)c;
+        }
+    }
+}
+
+
+/**
+ * @brief This function decodes the rest of a CSI sequence, '\033[' was already read.
+ *        Parameters are decimal numbers split by ';', the final byte is in '@'..'~'.
+ *
+ * @param event A pointer to the event receiving the key & its modifiers
+ */
+static void decode_csi(kevent_t *event) {
+    int params[MAX_PARAMS] = {0};
+    size_t index = 0;
+    bool private = false;
+
+    int c = next_byte(ESC_TIMEOUT);
+    if (c == LEFT_SQB) {
+        c = next_byte(ESC_TIMEOUT);
+        event->key = c >= 'A' && c <= 'E' ? LINUX_KEYS[c - 'A'] : UNKNOWN_KEY;
+        return;
+    }
+
+    for (; c >= 0; c = next_byte(ESC_TIMEOUT)) {
+        if (c >= '0' && c <= '9') {
+            if (index < MAX_PARAMS && params[index] < UINT16_MAX) {
+                params[index] = params[index] * 10 + (c - '0');
+            }
+        }
+        else if (c == ';') {
+            index += 1;
+        }
+        else if (c >= '<' && c <= '?') {
+            private = true; //? Replies of the terminal & mouse reports, not keys
+        }
+        else if (c >= '@' && c <= '~') {
+            break;
+        }
+        else if (c < ' ' || c > '/') {
+            //? Not a sequence byte, the sequence was cut short : give the byte back as its own key press
+            input_unget();
+            break;
+        }
+    }
+
+    event->key = UNKNOWN_KEY;
+    if (c < '@' || c > '~' || private) {
+        return;
+    }
+    if (c == '~') {
+        if (params[0] == PASTE_START) {
+            read_paste();
+            event->key = PASTE_KEY;
+            return;
+        }
+        if ((size_t)params[0] < sizeof(TILDE_KEYS) / sizeof(TILDE_KEYS[0]) && TILDE_KEYS[params[0]] != 0) {
+            event->key = TILDE_KEYS[params[0]];
+        }
+    }
+    else if (FINAL_KEYS[c] != 0) {
+        event->key = FINAL_KEYS[c];
+    }
+    //? '\033[1;5A' is CTRL + UP, the modifiers are the second parameter minus one
+    if (event->key != UNKNOWN_KEY && params[1] > 1) {
+        event->mods = (uint8_t)(params[1] - 1);
+    }
+}
+
+
+/**
+ * @brief This function decodes the rest of an SS3 sequence, '\033O' was already read
+ *
+ * @param event A pointer to the event receiving the key & its modifiers
+ */
+static void decode_ss3(kevent_t *event) {
+    int c = next_byte(ESC_TIMEOUT);
+    if (c >= '2' && c <= '9') {
+        event->mods = (uint8_t)(c - '1');
+        c = next_byte(ESC_TIMEOUT);
+    }
+
+    if (c == 'M') {
+        event->key = ENTER_KEY; //? ENTER of the keypad in application mode
+    }
+    else if (c >= 0 && c < 0x80 && FINAL_KEYS[c] != 0) {
+        event->key = FINAL_KEYS[c];
+    }
+    else {
+        event->key = UNKNOWN_KEY;
+    }
+}
+
+
+/**
+ * @brief This function reads one key press from the input layer, decoding escape sequences into key codes.
+ *        A lone ESC is reported once no other byte follows within ESC_TIMEOUT milliseconds,
+ *        & ESC followed by a plain character is that character with MOD_ALT.
+ *
+ * @param event A pointer to the event receiving the key & its modifiers
+ *
+ * @returns The key read, or INPUT_EOF if stdin is closed
+ */
+int keys_read(kevent_t *event) {
+    *event = (kevent_t){.key = events_wait_key(), .mods = MOD_NONE};
+    if (event->key == ESC_KEY) {
+        const int c = next_byte(ESC_TIMEOUT);
+        if (c == LEFT_SQB) {
+            decode_csi(event);
+        }
+        else if (c == 'O') {
+            decode_ss3(event);
+        }
+        else if (c >= SPACE_BAR && c < BACKSPACE) {
+            *event = (kevent_t){.key = c, .mods = MOD_ALT};
+        }
+        else if (c >= 0) {
+            input_unget();
+        }
+    }
+
+    crash_event(CRASH_KEY, event->key, (int32_t)event->mods);
+    return event->key;
+}
+
+
+/**
+ * @brief This function checks for another key press without blocking. The bytes the terminal already sent
+ *        are read into the input layer when its ring buffer is empty.
+ *
+ * @returns true if the bytes of another key press are waiting in the input layer, otherwise false
+ */
+bool keys_pending(void) {
+    return input_pending() || input_fill(0) > 0;
+}
+
+
+/**
+ * @brief This function gives the text of the last PASTE_KEY
+ *
+ * @param len A pointer receiving the length of the text
+ *
+ * @returns A pointer to the text, it is not null-terminated
+ */
+const char *keys_paste(size_t *len) {
+    *len = paste.len;
+    return paste.data;
+}
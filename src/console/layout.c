@@ -0,0 +1,110 @@
+#include "../../include/layout.h"
+#include "../../include/render.h"
+#include "../../include/output.h"
+#include "../../include/events.h"
+#include "../../include/crash.h"
+#include "../../include/utilities.h"
+
+
+// TODO : State of the layout, the size of the terminal & where the canvas is placed on it
+static struct LAYOUT {
+    int  rows;
+    int  cols;
+    int  origin_x;   //? Terminal column & row of the top left cell of the canvas (0-based)
+    int  origin_y;
+    bool fits;
+} layout = {.fits = true};
+
+
+/**
+ * @brief This function draws the notice shown while the terminal is smaller than the canvas.
+ *        It writes straight to the output sink, the canvas keeps its content for when the terminal is enlarged.
+ */
+static void draw_overlay(void) {
+    char line[2][BUF_SIZE];
+    snprintf(line[0], BUF_SIZE, "The terminal is too small (%ix%i)", layout.cols, layout.rows);
+    snprintf(line[1], BUF_SIZE, "Please enlarge it to at least %ix%i", CANVAS_WIDTH, CANVAS_HEIGHT);
+
+    out_printf("\033[?25l\033[%im", BOLD);
+    for (int i = 0; i < 2; i++) {
+        const int len = (int)strlen(line[i]);
+        const int x = layout.cols > len ? (layout.cols - len) / 2 : 0;
+        out_printf("\033[%i;%iH%s", layout.rows / 2 + i, x + 1, line[i]);
+    }
+    out_printf("\033[0m");
+    out_commit();
+}
+
+
+/**
+ * @brief This function reads the size of the terminal, centers the canvas on it, & redraws the current screen
+ *        from the back buffer of the renderer, or the notice if the canvas doesn't fit
+ */
+void layout_refresh(void) {
+    int rows, cols;
+    if (get_win_size(&rows, &cols) == IOCTL_ERROR) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to get win size!...\n");
+        return;
+    }
+
+    layout.rows = rows;
+    layout.cols = cols;
+    layout.fits = cols >= CANVAS_WIDTH && rows >= CANVAS_HEIGHT;
+    layout.origin_x = layout.fits ? (cols - CANVAS_WIDTH) / 2 : 0;
+    layout.origin_y = 0;
+
+    if (!render_active()) {
+        return;
+    }
+    render_set_viewport(layout.origin_x, layout.origin_y, layout.fits);
+    if (layout.fits) {
+        render_present();
+    }
+    else {
+        draw_overlay();
+    }
+}
+
+
+/**
+ * @brief This function is called by the event loop when SIGWINCH is received
+ *
+ * @param sig no use
+ */
+static void handle_resize(const int sig) {
+    (void)sig;
+    layout_refresh();
+    crash_event(CRASH_RESIZE, layout.cols, layout.rows);
+}
+
+
+/**
+ * @brief This function places the canvas on the terminal & forwards SIGWINCH through the event loop,
+ *        so a resize places it again outside of the signal context
+ *
+ * @returns true if resizes are followed, otherwise false
+ */
+bool layout_init(void) {
+    const bool handled = events_handle_signal(SIGWINCH, handle_resize);
+    if (!handled) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to handle SIGWINCH, resizes are ignored!...\n");
+    }
+    layout_refresh();
+    return handled;
+}
+
+
+/**
+ * @returns true if the terminal is large enough for the canvas, otherwise false
+ */
+bool layout_fits(void) {
+    return layout.fits;
+}
+
+
+/**
+ * @returns The X-coordinate of the box of the screens on the canvas, it doesn't change when the terminal is resized
+ */
+int layout_box_offset(void) {
+    return (CANVAS_WIDTH - MIN_BOX_WIDTH) / 2;
+}
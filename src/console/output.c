@@ -0,0 +1,254 @@
+#include <sys/uio.h>
+
+#include "../../include/output.h"
+#include "../../include/utilities.h"
+
+
+// TODO : The output sink, a growable byte buffer holding the frame that is not yet written
+static struct OUTPUT_SINK {
+    char    *data;
+    size_t   len;
+    size_t   cap;
+    bool     sync;    //? Wrap every frame in a synchronized update
+    bool     discard; //? Count the frames without writing them, there is no terminal
+    int      fd;      //? Written to, stdout unless the output of the program is kept for a report
+    ostats_t stats;
+} sink = {.fd = STDOUT_FILENO};
+
+static const char SYNC_BEGIN[] = "\033[?2026h";
+static const char SYNC_END[]   = "\033[?2026l";
+
+
+/**
+ * @brief This function grows the buffer of the sink to hold at least 'extra' more bytes
+ *
+ * @param extra The number of bytes about to be appended
+ *
+ * @returns true if the buffer is large enough, otherwise false
+ */
+static bool out_reserve(const size_t extra) {
+    if (sink.len + extra <= sink.cap) {
+        return true;
+    }
+
+    size_t cap = sink.cap ? sink.cap : MAX_BUFF * 32;
+    while (cap < sink.len + extra) {
+        cap *= 2;
+    }
+    char *data = realloc(sink.data, cap);
+    if (data == NULL) {
+        return false;
+    }
+    sink.data = data;
+    sink.cap = cap;
+    return true;
+}
+
+
+/**
+ * @brief This function appends raw bytes to the current frame
+ *
+ * @param bytes A pointer to the bytes to append
+ * @param len The number of bytes
+ */
+void out_write(const char *bytes, const size_t len) {
+    if (len == 0) {
+        return;
+    }
+    //? Commit what is pending and drop the bytes instead of failing silently halfway through a sequence
+    if (!out_reserve(len)) {
+        out_commit();
+        if (!out_reserve(len)) {
+            return;
+        }
+    }
+    memcpy(sink.data + sink.len, bytes, len);
+    sink.len += len;
+}
+
+
+/**
+ * @brief This function formats text straight into the buffer of the current frame
+ *
+ * @param fmt A pointer to the format string
+ * @param args The variable argument list
+ */
+void out_vprintf(const char *fmt, va_list args) {
+    va_list copy;
+    va_copy(copy, args);
+
+    const size_t avail = sink.cap - sink.len;
+    const int len = vsnprintf(sink.data ? sink.data + sink.len : NULL, avail, fmt, args);
+    if (len < 0) {
+        va_end(copy);
+        return;
+    }
+
+    if ((size_t)len >= avail) {
+        if (!out_reserve((size_t)len + 1)) {
+            va_end(copy);
+            return;
+        }
+        vsnprintf(sink.data + sink.len, (size_t)len + 1, fmt, copy);
+    }
+    sink.len += (size_t)len;
+    va_end(copy);
+}
+
+
+/**
+ * @brief This function formats text into the buffer of the current frame
+ *
+ * @param fmt A pointer to the format string
+ * @param ... Additional arguments
+ */
+void out_printf(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    out_vprintf(fmt, args);
+    va_end(args);
+}
+
+
+/**
+ * @brief This function writes the current frame to the terminal, retrying on partial writes
+ *        & interrupts, & waiting for room when the terminal is non-blocking & full, then updates
+ *        the write counters. With synchronized output on, the frame
+ *        is sent between the begin & end markers in the same writev call, so the terminal
+ *        draws it at once. An empty frame isn't written nor counted.
+ *
+ * @returns true if the whole frame is written, otherwise false
+ */
+bool out_commit(void) {
+    if (sink.len == 0) {
+        return true;
+    }
+
+    struct iovec iov[3];
+    int count = 0;
+
+    if (sink.sync) {
+        iov[count++] = (struct iovec){.iov_base = (void *)SYNC_BEGIN, .iov_len = sizeof(SYNC_BEGIN) - 1};
+    }
+    iov[count++] = (struct iovec){.iov_base = sink.data, .iov_len = sink.len};
+    if (sink.sync) {
+        iov[count++] = (struct iovec){.iov_base = (void *)SYNC_END, .iov_len = sizeof(SYNC_END) - 1};
+    }
+
+    size_t done = 0;
+    uint32_t syscalls = 0;
+    struct iovec *next = iov;
+    bool ret = true;
+
+    //? Without a terminal the frame counts as written in full, without a syscall
+    while (count > 0 && sink.discard) {
+        done += next->iov_len;
+        next += 1;
+        count -= 1;
+    }
+
+    while (count > 0) {
+        const ssize_t written = writev(sink.fd, next, count);
+        syscalls += 1;
+
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            //? A full non-blocking terminal is waited on instead of retried at once
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                struct pollfd pfd = {.fd = sink.fd, .events = POLLOUT};
+                int ready;
+                do {
+                    ready = poll(&pfd, 1, -1);
+                } while (ready < 0 && errno == EINTR);
+                if (ready > 0 && !(pfd.revents & (POLLERR | POLLHUP | POLLNVAL))) {
+                    continue;
+                }
+            }
+            ret = false;
+            break;
+        }
+        done += (size_t)written;
+
+        //? Skip the parts that are fully written & trim the one that is partially written
+        size_t left = (size_t)written;
+        while (count > 0 && left >= next->iov_len) {
+            left -= next->iov_len;
+            next += 1;
+            count -= 1;
+        }
+        if (count > 0) {
+            next->iov_base = (char *)next->iov_base + left;
+            next->iov_len -= left;
+        }
+    }
+
+    sink.stats.frames += 1;
+    sink.stats.frameBytes = done;
+    sink.stats.frameSyscalls = syscalls;
+    sink.stats.totalBytes += done;
+    sink.stats.totalSyscalls += syscalls;
+
+    sink.len = 0;
+    return ret;
+}
+
+
+/**
+ * @brief This function turns the synchronized output (DEC mode 2026) of the following frames on or off
+ *
+ * @param enable true if the terminal reported support for the mode
+ */
+void out_set_sync(const bool enable) {
+    sink.sync = enable;
+}
+
+
+/**
+ * @returns true if the frames are wrapped in synchronized updates, otherwise false
+ */
+bool out_sync_enabled(void) {
+    return sink.sync;
+}
+
+
+/**
+ * @brief This function makes the following frames be counted & dropped instead of written to stdout
+ *
+ * @param discard true while there is no terminal to write to
+ */
+void out_set_discard(const bool discard) {
+    sink.discard = discard;
+}
+
+
+/**
+ * @brief This function makes the following frames be written to another file descriptor than stdout
+ *        (ie: stderr, so the status lines of the setup don't mix with the question report printed to stdout)
+ *
+ * @param fd The file descriptor
+ */
+void out_set_fd(const int fd) {
+    sink.fd = fd;
+}
+
+
+/**
+ * @returns The number of bytes waiting in the current frame
+ */
+size_t out_pending(void) {
+    return sink.len;
+}
+
+
+/**
+ * @brief This function copies the write counters of the sink
+ *
+ * @param stats A pointer to the structure to hold the counters
+ */
+void out_stats(ostats_t *stats) {
+    if (stats != NULL) {
+        *stats = sink.stats;
+    }
+}
@@ -0,0 +1,222 @@
+#include "../../include/palette.h"
+#include "../../include/render.h"
+#include "../../include/output.h"
+#include "../../include/utilities.h"
+
+
+// TODO : The RGB values of the fixed color themes, a theme without foreground keeps the default one
+static const struct THEME_COLORS {
+    RGBset_t colors;
+    bool     hasForeground;
+} THEMES[THEME_COUNT] = {
+    [THEME_ERROR]         = {.colors = {.foreground = {255, 255, 255}, .background = {255, 0, 0}},     .hasForeground = true},
+    [THEME_SUCCESS]       = {.colors = {.foreground = {255, 255, 255}, .background = {0, 115, 2}},     .hasForeground = true},
+    [THEME_BANNER]        = {.colors = {.foreground = {255, 255, 0},   .background = {178, 0, 0}},     .hasForeground = true},
+    [THEME_HIGHLIGHT]     = {.colors = {.foreground = {0, 0, 0},       .background = {255, 255, 255}}, .hasForeground = true},
+    [THEME_PROGRESS_DONE] = {.colors = {.background = {255, 215, 0}},                                  .hasForeground = false},
+    [THEME_PROGRESS_LEFT] = {.colors = {.background = {112, 128, 144}},                                .hasForeground = false},
+};
+
+// TODO : A precomputed SGR string
+typedef struct SGR_STRING {
+    char   bytes[SGR_PARAM_SIZE];
+    size_t len;
+} sgr_t;
+
+// TODO : The palette, built once by 'palette_init'
+static struct PALETTE {
+    bool  ready;
+    bool  truecolor;                          //? COLORTERM reports 24-bit color support
+    sgr_t indexed[2][RGB_MAX + 1];            //? "38;5;N" & "48;5;N" for every 256 color mode index
+    sgr_t themeParams[THEME_COUNT][2];        //? Foreground & background parameters of the themes
+    uint32_t themeColors[THEME_COUNT][2];     //? Cell colors of the themes
+    char   themeSgr[THEME_COUNT][SGR_THEME_SIZE];
+    size_t themeSgrLen[THEME_COUNT];
+} palette;
+
+
+/**
+ * @brief This function formats the SGR parameters selecting a cell color
+ *
+ * @param sgr A pointer to the structure to hold the parameters
+ * @param color The cell color
+ * @param background true for the background parameters, false for the foreground ones
+ */
+static void format_param(sgr_t *sgr, const uint32_t color, const bool background) {
+    const int layer = background ? BACKGROUND : FOREGROUND;
+    int len;
+    if (color & COLOR_RGB) {
+        len = snprintf(sgr->bytes, sizeof(sgr->bytes), "%i;2;%u;%u;%u", layer,
+                       color >> 16 & 0xFF, color >> 8 & 0xFF, color & 0xFF);
+    }
+    else if (color & COLOR_INDEXED) {
+        len = snprintf(sgr->bytes, sizeof(sgr->bytes), "%i;%i;%u", layer, BIT_MODE, color & 0xFF);
+    }
+    else {
+        len = snprintf(sgr->bytes, sizeof(sgr->bytes), "%i", background ? 49 : 39);
+    }
+    sgr->len = len > 0 ? (size_t)len : 0;
+}
+
+
+/**
+ * @brief This function builds the SGR parameters of every 256 color mode index & the escape
+ *        sequences of the color themes. 24-bit colors are used when the COLORTERM environment
+ *        variable is 'truecolor' or '24bit'.
+ */
+void palette_init(void) {
+    const char *colorterm = getenv("COLORTERM");
+    palette.truecolor = colorterm != NULL && (strcmp(colorterm, "truecolor") == 0 || strcmp(colorterm, "24bit") == 0);
+
+    for (uint32_t i = 0; i <= RGB_MAX; i++) {
+        format_param(&palette.indexed[0][i], COLOR_INDEXED | i, false);
+        format_param(&palette.indexed[1][i], COLOR_INDEXED | i, true);
+    }
+
+    palette.ready = true;
+    for (int t = 0; t < THEME_COUNT; t++) {
+        const uint32_t fg = THEMES[t].hasForeground ? palette_color(THEMES[t].colors.foreground) : COLOR_DEFAULT;
+        const uint32_t bg = palette_color(THEMES[t].colors.background);
+        palette.themeColors[t][0] = fg;
+        palette.themeColors[t][1] = bg;
+        format_param(&palette.themeParams[t][0], fg, false);
+        format_param(&palette.themeParams[t][1], bg, true);
+
+        const int len = THEMES[t].hasForeground
+            ? snprintf(palette.themeSgr[t], SGR_THEME_SIZE, "\033[%s;%sm", palette.themeParams[t][0].bytes, palette.themeParams[t][1].bytes)
+            : snprintf(palette.themeSgr[t], SGR_THEME_SIZE, "\033[%sm", palette.themeParams[t][1].bytes);
+        palette.themeSgrLen[t] = len > 0 ? (size_t)len : 0;
+    }
+}
+
+
+/**
+ * @returns true if the colors are sent as 24-bit colors, otherwise false
+ */
+bool palette_truecolor(void) {
+    if (!palette.ready) {
+        palette_init();
+    }
+    return palette.truecolor;
+}
+
+
+/**
+ * @brief This function converts the given rgb values to the nearest color of the 6x6x6 cube of the 256 color mode.
+ *        (c * 5 + 127) / 255 rounds c / 255 * 5 to the nearest integer, a tie is impossible since 255 is odd.
+ *
+ * @param rgb RGB color structure
+ *
+ * @returns The 256 color mode index of the RGB values passed
+ */
+uint8_t palette_index(const RGB_t rgb) {
+    const uint8_t R_index = (uint8_t)((rgb.red * BIT_MODE + RGB_MAX / 2) / RGB_MAX);
+    const uint8_t G_index = (uint8_t)((rgb.green * BIT_MODE + RGB_MAX / 2) / RGB_MAX);
+    const uint8_t B_index = (uint8_t)((rgb.blue * BIT_MODE + RGB_MAX / 2) / RGB_MAX);
+
+    return BIT_OFFSET + R_index * R_FACTOR + G_index * G_FACTOR + B_index * B_FACTOR;
+}
+
+
+/**
+ * @brief This function converts the given rgb values to the cell color sent to the terminal
+ *
+ * @param rgb RGB color structure
+ *
+ * @returns A 24-bit color if the terminal supports it, otherwise a 256 color mode index
+ */
+uint32_t palette_color(const RGB_t rgb) {
+    if (palette_truecolor()) {
+        return COLOR_RGB | (uint32_t)rgb.red << 16 | (uint32_t)rgb.green << 8 | rgb.blue;
+    }
+    return COLOR_INDEXED | palette_index(rgb);
+}
+
+
+/**
+ * @brief This function gets the cell colors of a color theme
+ *
+ * @param theme The color theme
+ * @param fg A pointer to the variable to hold the foreground color
+ * @param bg A pointer to the variable to hold the background color
+ */
+void palette_theme(const themes_t theme, uint32_t *fg, uint32_t *bg) {
+    if (!palette.ready) {
+        palette_init();
+    }
+    *fg = palette.themeColors[theme][0];
+    *bg = palette.themeColors[theme][1];
+}
+
+
+/**
+ * @brief This function gets the SGR parameters selecting a cell color, without the leading '\033[' & trailing 'm'.
+ *        The parameters of the 256 color mode indexes & the theme colors are precomputed, any other
+ *        24-bit color is formatted into a static buffer that is overwritten by the next call.
+ *
+ * @param color The cell color
+ * @param background true for the background parameters, false for the foreground ones
+ * @param len A pointer to the variable to hold the length of the parameters
+ *
+ * @returns A pointer to the SGR parameters
+ */
+const char *palette_param(const uint32_t color, const bool background, size_t *len) {
+    if (!palette.ready) {
+        palette_init();
+    }
+    const int layer = background ? 1 : 0;
+
+    if (color & COLOR_INDEXED) {
+        *len = palette.indexed[layer][color & 0xFF].len;
+        return palette.indexed[layer][color & 0xFF].bytes;
+    }
+    for (int t = 0; t < THEME_COUNT; t++) {
+        if (palette.themeColors[t][layer] == color) {
+            *len = palette.themeParams[t][layer].len;
+            return palette.themeParams[t][layer].bytes;
+        }
+    }
+
+    static sgr_t scratch;
+    format_param(&scratch, color, background);
+    *len = scratch.len;
+    return scratch.bytes;
+}
+
+
+/**
+ * @brief This function gets the escape sequence selecting the colors of a theme
+ *
+ * @param theme The color theme
+ * @param len A pointer to the variable to hold the length of the sequence
+ *
+ * @returns A pointer to the escape sequence
+ */
+const char *palette_theme_sgr(const themes_t theme, size_t *len) {
+    if (!palette.ready) {
+        palette_init();
+    }
+    *len = palette.themeSgrLen[theme];
+    return palette.themeSgr[theme];
+}
+
+
+/**
+ * @brief This function sets the terminal foreground & background color to the colors of a theme
+ *
+ * @param theme The color theme
+ */
+void set_console_theme(const themes_t theme) {
+    if (render_active()) {
+        uint32_t fg, bg;
+        palette_theme(theme, &fg, &bg);
+        if (THEMES[theme].hasForeground) {
+            render_set_fg(fg);
+        }
+        render_set_bg(bg);
+        return;
+    }
+    size_t len;
+    const char *sgr = palette_theme_sgr(theme, &len);
+    out_write(sgr, len);
+}
@@ -0,0 +1,677 @@
+#include "../../include/render.h"
+#include "../../include/output.h"
+#include "../../include/palette.h"
+#include "../../include/console.h"
+#include "../../include/layout.h"
+#include "../../include/width.h"
+#include "../../include/utilities.h"
+
+
+// TODO : State of the renderer, the front buffer mirrors what is on the terminal
+//? The buffers hold the logical canvas of the screens, it is drawn at the origin set by the layout
+static struct RENDERER {
+    cell_t *front;
+    cell_t *back;
+    int     rows;
+    int     cols;
+    int     org_x;       //? Terminal column & row of the top left cell of the canvas (0-based)
+    int     org_y;
+    bool    visible;     //? false while the terminal is too small for the canvas
+    rtargets_t target;
+
+    int      cur_x;      //? Virtual cursor (0-based)
+    int      cur_y;
+    uint16_t pen_style;  //? Attributes applied to the next glyphs
+    uint32_t pen_fg;
+    uint32_t pen_bg;
+    cell_t   term_pen;   //? Attributes the terminal currently draws with, kept across frames
+
+    bool active;
+    bool cursor_visible;
+    bool term_cursor_visible;
+} renderer;
+
+static const cell_t BLANK_CELL = {
+    .glyph = " ", .fg = COLOR_DEFAULT, .bg = COLOR_DEFAULT, .style = 0, .width = 1, .reserved = 0
+};
+
+
+/**
+ * @brief This function fills a buffer of cells with blank cells
+ *
+ * @param cells A pointer to the cells to clear
+ * @param count The number of cells
+ */
+static void fill_blank(cell_t *cells, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        cells[i] = BLANK_CELL;
+    }
+}
+
+
+/**
+ * @brief This function compares the attributes of two cells
+ *
+ * @returns true if both cells are drawn with the same SGR attributes
+ */
+static bool same_attributes(const cell_t *a, const cell_t *b) {
+    return a->style == b->style && a->fg == b->fg && a->bg == b->bg;
+}
+
+
+/**
+ * @brief This function allocates the front & back buffers to the size of the canvas and clears the screen once.
+ *        Until it is called, the output functions write straight to the output sink.
+ *
+ * @returns true if the renderer is ready, otherwise false
+ */
+bool render_init(void) {
+    const int rows = CANVAS_HEIGHT, cols = CANVAS_WIDTH;
+    const size_t count = (size_t)rows * (size_t)cols;
+    renderer.front = calloc(count, sizeof(cell_t));
+    renderer.back = calloc(count, sizeof(cell_t));
+    if (renderer.front == NULL || renderer.back == NULL) {
+        log_error(__func__, __FILE__, __LINE__, "calloc() : %s\n", strerror(ENOMEM));
+        free(renderer.front);
+        free(renderer.back);
+        renderer.front = renderer.back = NULL;
+        return false;
+    }
+    fill_blank(renderer.front, count);
+    fill_blank(renderer.back, count);
+
+    renderer.rows = rows;
+    renderer.cols = cols;
+    renderer.org_x = renderer.org_y = 0;
+    renderer.visible = true;
+    renderer.cur_x = renderer.cur_y = 0;
+    renderer.pen_style = 0;
+    renderer.pen_fg = renderer.pen_bg = COLOR_DEFAULT;
+    renderer.term_pen = BLANK_CELL;
+    renderer.cursor_visible = renderer.term_cursor_visible = true;
+    renderer.active = true;
+
+    //? The only full clear of the screen, every other frame is a diff against the front buffer
+    out_printf("\033[0m\033[H\033[2J");
+    out_commit();
+    return true;
+}
+
+
+/**
+ * @returns true if the output functions draw into the cell grid, otherwise false
+ */
+bool render_active(void) {
+    return renderer.active;
+}
+
+
+/**
+ * @brief This function presents the last frame, then releases the buffers. The output
+ *        functions write straight to the output sink again afterwards.
+ */
+void render_shutdown(void) {
+    if (!renderer.active) {
+        return;
+    }
+    render_present();
+    renderer.active = false;
+
+    if (!same_attributes(&renderer.term_pen, &BLANK_CELL)) {
+        out_printf("\033[0m");
+        out_commit();
+    }
+
+    free(renderer.front);
+    free(renderer.back);
+    renderer.front = renderer.back = NULL;
+}
+
+
+/**
+ * @brief This function selects where the next frames are presented. The output sink only writes to stdout
+ *        for the terminal, so the screens can be driven without one.
+ *
+ * @param target The target of the frames
+ */
+void render_set_target(const rtargets_t target) {
+    renderer.target = target;
+    out_set_discard(target != TARGET_TERMINAL);
+}
+
+
+/**
+ * @returns The target the frames are presented to
+ */
+rtargets_t render_target(void) {
+    return renderer.target;
+}
+
+
+/**
+ * @brief This function reads a cell of the last presented frame (ie: what the terminal shows)
+ *
+ * @param x_coord X-coordinate of the cell on the canvas (1-based)
+ * @param y_coord Y-coordinate of the cell on the canvas (1-based)
+ * @param cell A pointer to the structure receiving the cell
+ *
+ * @returns true if the cell is on the canvas, otherwise false
+ */
+bool render_peek(const int x_coord, const int y_coord, cell_t *cell) {
+    const int x = x_coord - 1, y = y_coord - 1;
+    if (!renderer.active || cell == NULL || x < 0 || y < 0 || x >= renderer.cols || y >= renderer.rows) {
+        return false;
+    }
+    *cell = renderer.front[(size_t)y * (size_t)renderer.cols + (size_t)x];
+    return true;
+}
+
+
+/**
+ * @brief This function copies the glyphs of a row of the last presented frame as UTF-8 text, without the attributes
+ *
+ * @param y_coord Y-coordinate of the row on the canvas (1-based)
+ * @param dest A pointer to the buffer receiving the null-terminated text
+ * @param size The size of the buffer
+ *
+ * @returns The number of bytes copied
+ */
+size_t render_peek_row(const int y_coord, char *dest, const size_t size) {
+    const int y = y_coord - 1;
+    if (dest == NULL || size == 0) {
+        return 0;
+    }
+    dest[0] = NULL_TERM;
+    if (!renderer.active || y < 0 || y >= renderer.rows) {
+        return 0;
+    }
+
+    size_t len = 0;
+    const cell_t *row = renderer.front + (size_t)y * (size_t)renderer.cols;
+    for (int x = 0; x < renderer.cols; x++) {
+        const size_t n = strlen(row[x].glyph);
+        if (len + n >= size) {
+            break;
+        }
+        memcpy(dest + len, row[x].glyph, n);
+        len += n;
+    }
+    dest[len] = NULL_TERM;
+    return len;
+}
+
+
+/**
+ * @brief This function places the canvas on the terminal after a resize. What the terminal shows is unknown
+ *        afterwards, so the screen is erased & the next present sends the drawn cells of the canvas
+ *        from the back buffer, without the screens drawing it again.
+ *
+ * @param x_coord Terminal column of the left edge of the canvas (0-based)
+ * @param y_coord Terminal row of the top edge of the canvas (0-based)
+ * @param visible false to stop presenting while the terminal is too small for the canvas
+ */
+void render_set_viewport(const int x_coord, const int y_coord, const bool visible) {
+    if (!renderer.active) {
+        return;
+    }
+    renderer.org_x = x_coord;
+    renderer.org_y = y_coord;
+    renderer.visible = visible;
+
+    //? The erased screen is blank, so only the drawn cells are sent again
+    fill_blank(renderer.front, (size_t)renderer.rows * (size_t)renderer.cols);
+    renderer.term_pen = BLANK_CELL;
+    renderer.term_cursor_visible = !renderer.cursor_visible;
+    out_printf("\033[0m\033[H\033[2J");
+}
+
+
+/**
+ * @brief This function clears the back buffer & moves the virtual cursor to the top left corner
+ */
+void render_clear(void) {
+    if (!renderer.active) {
+        return;
+    }
+    fill_blank(renderer.back, (size_t)renderer.rows * (size_t)renderer.cols);
+    renderer.cur_x = renderer.cur_y = 0;
+}
+
+
+/**
+ * @returns The number of cells of the canvas, ie: the size of a snapshot of the back buffer
+ */
+size_t render_cells(void) {
+    return (size_t)CANVAS_WIDTH * (size_t)CANVAS_HEIGHT;
+}
+
+
+/**
+ * @brief This function copies the back buffer, so a drawn frame can be blitted back later without drawing it again
+ *
+ * @param cells A pointer to the cells receiving the copy
+ * @param count The number of cells, it must be 'render_cells()'
+ *
+ * @returns true if the back buffer was copied, otherwise false
+ */
+bool render_snapshot(cell_t *cells, const size_t count) {
+    if (!renderer.active || cells == NULL || count != render_cells()) {
+        return false;
+    }
+    memcpy(cells, renderer.back, count * sizeof(cell_t));
+    return true;
+}
+
+
+/**
+ * @brief This function replaces the back buffer with a snapshot & moves the virtual cursor to the top left corner,
+ *        like 'render_clear' does. The next present sends the cells that differ from the terminal only.
+ *
+ * @param cells A pointer to the cells of the snapshot
+ * @param count The number of cells, it must be 'render_cells()'
+ *
+ * @returns true if the snapshot was blitted, otherwise false
+ */
+bool render_blit(const cell_t *cells, const size_t count) {
+    if (!renderer.active || cells == NULL || count != render_cells()) {
+        return false;
+    }
+    memcpy(renderer.back, cells, count * sizeof(cell_t));
+    renderer.cur_x = renderer.cur_y = 0;
+    return true;
+}
+
+
+/**
+ * @brief This function moves the virtual cursor to the given X-Y coordinates (1-based like ANSI escape sequences)
+ *
+ * @param x_coord X-coordinate of the cursor
+ * @param y_coord Y-coordinate of the cursor
+ */
+void render_move(const int x_coord, const int y_coord) {
+    renderer.cur_x = x_coord - 1;
+    renderer.cur_y = y_coord - 1;
+}
+
+
+/**
+ * @brief This function moves the virtual cursor back by 'n' cells, blanking them
+ *
+ * @param n The number of cells to delete
+ */
+void render_backspace(const size_t n) {
+    for (size_t i = 0; i < n && renderer.cur_x > 0; i++) {
+        renderer.cur_x -= 1;
+        render_write(" ", 1);
+        renderer.cur_x -= 1;
+    }
+}
+
+
+/**
+ * @brief This function updates the text attributes of the pen the same way the SGR codes update the terminal
+ *
+ * @param textStyle text mode/style
+ */
+void render_set_style(const int textStyle) {
+    switch (textStyle) {
+        case RESET_ATTR :
+            renderer.pen_style = 0;
+            renderer.pen_fg = renderer.pen_bg = COLOR_DEFAULT;
+        break;
+
+        case DIM :
+        case INVERT :
+            renderer.pen_style |= 1U << BOLD | 1U << textStyle;
+        break;
+
+        default :
+            if (TS_VALID(textStyle) && textStyle < 16) {
+                renderer.pen_style |= 1U << textStyle;
+            }
+        break;
+    }
+}
+
+
+/**
+ * @param color The foreground color of the pen
+ */
+void render_set_fg(const uint32_t color) {
+    renderer.pen_fg = color;
+}
+
+
+/**
+ * @param color The background color of the pen
+ */
+void render_set_bg(const uint32_t color) {
+    renderer.pen_bg = color;
+}
+
+
+/**
+ * @param visible Whether the cursor is shown after the next present
+ */
+void render_set_cursor_visible(const bool visible) {
+    renderer.cursor_visible = visible;
+}
+
+
+/**
+ * @brief This function blanks the half of a wide glyph that is about to lose its other half
+ *
+ * @param row A pointer to the first cell of the row
+ * @param x The column being overwritten
+ */
+static void split_wide_glyph(cell_t *row, const int x) {
+    if (row[x].width == 0 && x > 0) {
+        row[x - 1] = BLANK_CELL;
+    }
+    if (row[x].width == WIDE_GLYPH && x + 1 < renderer.cols) {
+        row[x + 1] = BLANK_CELL;
+    }
+}
+
+
+/**
+ * @brief This function stores a glyph at the virtual cursor with the attributes of the pen and advances the cursor
+ *
+ * @param bytes A pointer to the UTF-8 bytes of the glyph
+ * @param len The number of bytes
+ * @param width The number of columns the glyph occupies
+ */
+static void put_glyph(const char *bytes, const size_t len, const int width) {
+    const int x = renderer.cur_x, y = renderer.cur_y;
+    renderer.cur_x += width;
+
+    if (y < 0 || y >= renderer.rows || x < 0 || x + width > renderer.cols) {
+        return;
+    }
+
+    cell_t *row = renderer.back + (size_t)y * (size_t)renderer.cols;
+    for (int i = x; i < x + width; i++) {
+        split_wide_glyph(row, i);
+    }
+
+    cell_t cell = {
+        .fg = renderer.pen_fg, .bg = renderer.pen_bg, .style = renderer.pen_style, .width = (uint8_t)width, .reserved = 0
+    };
+    memcpy(cell.glyph, bytes, len < GLYPH_SIZE ? len : GLYPH_SIZE - 1);
+    row[x] = cell;
+
+    if (width == WIDE_GLYPH) {
+        memset(cell.glyph, 0, GLYPH_SIZE);
+        cell.width = 0;
+        row[x + 1] = cell;
+    }
+}
+
+
+/**
+ * @brief This function appends a zero width codepoint (combining mark, variation selector, ...) to the previous glyph
+ *
+ * @param bytes A pointer to the UTF-8 bytes of the codepoint
+ * @param len The number of bytes
+ */
+static void join_glyph(const char *bytes, const size_t len) {
+    int x = renderer.cur_x - 1;
+    const int y = renderer.cur_y;
+    if (y < 0 || y >= renderer.rows || x < 0 || x >= renderer.cols) {
+        return;
+    }
+
+    cell_t *row = renderer.back + (size_t)y * (size_t)renderer.cols;
+    if (row[x].width == 0 && x > 0) {
+        x -= 1;
+    }
+    const size_t used = strlen(row[x].glyph);
+    if (used + len < GLYPH_SIZE) {
+        memcpy(row[x].glyph + used, bytes, len);
+    }
+}
+
+
+/**
+ * @brief This function draws UTF-8 text into the back buffer at the virtual cursor.
+ *        '\n', '\r', '\t' & '\b' move the virtual cursor the same way they move the terminal cursor.
+ *
+ * @param text A pointer to the text to draw
+ * @param len The number of bytes of the text
+ */
+void render_write(const char *text, const size_t len) {
+    size_t i = 0;
+    while (i < len) {
+        uint32_t cp;
+        const size_t n = width_decode(text + i, len - i, &cp);
+
+        switch (cp) {
+            case '\n' :
+                renderer.cur_x = 0;
+                renderer.cur_y += 1;
+            break;
+
+            case '\r' :
+                renderer.cur_x = 0;
+            break;
+
+            case '\t' :
+                renderer.cur_x = (renderer.cur_x / TAB_WIDTH + 1) * TAB_WIDTH;
+            break;
+
+            case '\b' :
+                if (renderer.cur_x > 0) {
+                    renderer.cur_x -= 1;
+                }
+            break;
+
+            default : {
+                //? C0 & C1 control characters draw nothing
+                if (cp < SPACE_BAR || (cp >= BACKSPACE && cp < 0xA0)) {
+                    break;
+                }
+                const int width = width_codepoint(cp);
+                if (width == 0) {
+                    join_glyph(text + i, n);
+                }
+                else {
+                    put_glyph(text + i, n, width == WIDE_GLYPH ? WIDE_GLYPH : 1);
+                }
+            }
+            break;
+        }
+        i += n;
+    }
+}
+
+
+/**
+ * @brief This function formats text & draws it into the back buffer at the virtual cursor
+ *
+ * @param fmt A pointer to the format string
+ * @param args The variable argument list
+ */
+void render_vprintf(const char *fmt, va_list args) {
+    char text[MAX_BUFF * 2];
+    va_list copy;
+    va_copy(copy, args);
+    const int len = vsnprintf(text, sizeof(text), fmt, args);
+
+    if (len < 0) {
+        va_end(copy);
+        return;
+    }
+    if ((size_t)len < sizeof(text)) {
+        render_write(text, (size_t)len);
+        va_end(copy);
+        return;
+    }
+
+    char *long_text = malloc((size_t)len + 1);
+    if (long_text != NULL) {
+        vsnprintf(long_text, (size_t)len + 1, fmt, copy);
+        render_write(long_text, (size_t)len);
+        free(long_text);
+    }
+    va_end(copy);
+}
+
+
+/**
+ * @brief This function appends one parameter to an SGR sequence being built
+ *
+ * @param seq A pointer to the sequence
+ * @param len A pointer to the length of the sequence
+ * @param param A pointer to the parameter
+ * @param plen The length of the parameter
+ */
+static void sgr_append(char *seq, size_t *len, const char *param, const size_t plen) {
+    if (*len + plen + 1 >= MIN_BUFF) {
+        return;
+    }
+    if (*len > 2) {
+        seq[(*len)++] = ';';
+    }
+    memcpy(seq + *len, param, plen);
+    *len += plen;
+}
+
+
+/**
+ * @brief This function appends the SGR sequence changing the attributes of the terminal to the attributes
+ *        of a cell. Only the attributes that differ are sent, switching off a style uses its own reset code
+ *        (22 for bold & dim, 20 + code for the others) instead of resetting everything.
+ *
+ * @param to A pointer to the cell whose attributes are selected
+ */
+static void emit_attributes(const cell_t *to) {
+    cell_t *from = &renderer.term_pen;
+    if (same_attributes(from, to)) {
+        return;
+    }
+    if (to->style == 0 && to->fg == COLOR_DEFAULT && to->bg == COLOR_DEFAULT) {
+        out_write("\033[0m", 4);
+        *from = *to;
+        return;
+    }
+
+    char seq[MIN_BUFF] = "\033[";
+    size_t len = 2;
+    char code[BUF_SIZE];
+
+    uint16_t added = to->style & ~from->style;
+    const uint16_t removed = from->style & ~to->style;
+    const uint16_t intensity = 1U << BOLD | 1U << DIM;
+
+    //? 22 switches off both bold & dim, the one that stays on is sent again
+    if (removed & intensity) {
+        sgr_append(seq, &len, "22", 2);
+        added |= to->style & intensity;
+    }
+    for (int style = ITALIC; style <= HIDDEN; style++) {
+        if (removed & 1U << style) {
+            sgr_append(seq, &len, code, (size_t)snprintf(code, sizeof(code), "%i", 20 + style));
+        }
+    }
+    for (int style = BOLD; style <= HIDDEN; style++) {
+        if (added & 1U << style) {
+            sgr_append(seq, &len, code, (size_t)snprintf(code, sizeof(code), "%i", style));
+        }
+    }
+
+    size_t plen;
+    if (from->fg != to->fg) {
+        const char *param = palette_param(to->fg, false, &plen);
+        sgr_append(seq, &len, param, plen);
+    }
+    if (from->bg != to->bg) {
+        const char *param = palette_param(to->bg, true, &plen);
+        sgr_append(seq, &len, param, plen);
+    }
+    seq[len++] = 'm';
+    out_write(seq, len);
+
+    from->style = to->style;
+    from->fg = to->fg;
+    from->bg = to->bg;
+}
+
+
+/**
+ * @brief This function sends the cells of the back buffer that differ from the front buffer to the terminal
+ *        as one escape stream. Unchanged cells between two close changes on the same row are re-sent
+ *        instead of moving the cursor. The front buffer then mirrors the back buffer.
+ *        Without the cell grid, or while the canvas doesn't fit, it only commits what was written so far.
+ */
+void render_present(void) {
+    if (!renderer.active || !renderer.visible || renderer.target == TARGET_NULL) {
+        out_commit();
+        return;
+    }
+
+    const int cols = renderer.cols;
+    int term_x = -1, term_y = -1;   //? Position of the terminal cursor, unknown at the start of a frame
+
+    for (int y = 0; y < renderer.rows; y++) {
+        const cell_t *back = renderer.back + (size_t)y * (size_t)cols;
+        const cell_t *front = renderer.front + (size_t)y * (size_t)cols;
+
+        int x = 0;
+        while (x < cols) {
+            if (memcmp(&back[x], &front[x], sizeof(cell_t)) == 0) {
+                x += 1;
+                continue;
+            }
+            //? A changed right half is redrawn from its wide glyph
+            if (back[x].width == 0 && x > 0) {
+                x -= 1;
+            }
+
+            //? Extend the span while the next change is close enough
+            int end = x + 1;
+            for (int gap = 0, i = x + 1; i < cols && gap <= SPAN_GAP; i++) {
+                if (memcmp(&back[i], &front[i], sizeof(cell_t)) != 0) {
+                    end = i + 1;
+                    gap = 0;
+                }
+                else {
+                    gap += 1;
+                }
+            }
+
+            if (term_y != y || term_x != x) {
+                if (term_y == y && term_x < x) {
+                    out_printf("\033[%iC", x - term_x);
+                }
+                else {
+                    out_printf("\033[%i;%iH", renderer.org_y + y + 1, renderer.org_x + x + 1);
+                }
+            }
+
+            for (int i = x; i < end; i++) {
+                if (back[i].width == 0) {
+                    continue;
+                }
+                emit_attributes(&back[i]);
+                out_write(back[i].glyph, strlen(back[i].glyph));
+            }
+            if (end < cols && back[end].width == 0) {
+                end += 1;
+            }
+            term_x = end;
+            term_y = y;
+            x = end;
+        }
+    }
+
+    if (renderer.cur_x != term_x || renderer.cur_y != term_y) {
+        out_printf("\033[%i;%iH", renderer.org_y + renderer.cur_y + 1, renderer.org_x + renderer.cur_x + 1);
+    }
+    if (renderer.cursor_visible != renderer.term_cursor_visible) {
+        out_printf(renderer.cursor_visible ? "\033[?25h" : "\033[?25l");
+        renderer.term_cursor_visible = renderer.cursor_visible;
+    }
+
+    memcpy(renderer.front, renderer.back, (size_t)renderer.rows * (size_t)cols * sizeof(cell_t));
+    out_commit();
+}
@@ -0,0 +1,123 @@
+#include "../../include/template.h"
+#include "../../include/render.h"
+#include "../../include/utilities.h"
+
+
+// TODO : A slot of the template cache
+typedef struct TEMPLATE_SLOT {
+    uint64_t key;
+    uint64_t used_at;   //? Tick of the last load or store, 0 for an empty slot
+    cell_t  *cells;
+} tslot_t;
+
+static tslot_t slots[TEMPLATE_SLOTS];
+static uint64_t ticks;
+
+
+/**
+ * @brief This function continues a FNV-1a hash over a block of bytes, so the inputs of a screen can be hashed
+ *        one after the other into the key of its template
+ *
+ * @param hash The hash so far, 0 to start a new one
+ * @param data A pointer to the bytes
+ * @param len The number of bytes
+ *
+ * @returns The updated hash
+ */
+uint64_t template_hash(uint64_t hash, const void *data, const size_t len) {
+    if (hash == 0) {
+        hash = 14695981039346656037ULL;
+    }
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+
+/**
+ * @brief This function continues a hash over a null-terminated string, NULL hashes differently from ""
+ *
+ * @param hash The hash so far, 0 to start a new one
+ * @param str A pointer to the string, or NULL
+ *
+ * @returns The updated hash
+ */
+uint64_t template_hash_str(const uint64_t hash, const char *str) {
+    if (str == NULL) {
+        const unsigned char none = 0xFF;
+        return template_hash(hash, &none, sizeof(none));
+    }
+    //? The terminator is hashed too, so consecutive strings can't run into each other
+    return template_hash(hash, str, strlen(str) + 1);
+}
+
+
+/**
+ * @brief This function blits the template stored under a key into the back buffer of the renderer
+ *
+ * @param key The hash of what the template was drawn from
+ *
+ * @returns true if the template was blitted, otherwise false & the screen has to be drawn
+ */
+bool template_load(const uint64_t key) {
+    for (size_t i = 0; i < TEMPLATE_SLOTS; i++) {
+        if (slots[i].used_at != 0 && slots[i].key == key) {
+            if (!render_blit(slots[i].cells, render_cells())) {
+                return false;
+            }
+            slots[i].used_at = ++ticks;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief This function stores the back buffer of the renderer as the template of a key,
+ *        in an empty slot or in place of the least recently used template
+ *
+ * @param key The hash of what the back buffer was drawn from
+ */
+void template_store(const uint64_t key) {
+    if (!render_active()) {
+        return;
+    }
+    tslot_t *slot = &slots[0];
+    for (size_t i = 0; i < TEMPLATE_SLOTS; i++) {
+        if (slots[i].used_at != 0 && slots[i].key == key) {
+            slot = &slots[i];
+            break;
+        }
+        if (slots[i].used_at < slot->used_at) {
+            slot = &slots[i];
+        }
+    }
+
+    if (slot->cells == NULL) {
+        slot->cells = malloc(render_cells() * sizeof(cell_t));
+        if (slot->cells == NULL) {
+            log_error(__func__, __FILE__, __LINE__, "malloc() : %s\n", strerror(ENOMEM));
+            return;
+        }
+    }
+    if (!render_snapshot(slot->cells, render_cells())) {
+        slot->used_at = 0;
+        return;
+    }
+    slot->key = key;
+    slot->used_at = ++ticks;
+}
+
+
+/**
+ * @brief This function releases the templates
+ */
+void template_shutdown(void) {
+    for (size_t i = 0; i < TEMPLATE_SLOTS; i++) {
+        free(slots[i].cells);
+        slots[i] = (tslot_t){.key = 0, .used_at = 0, .cells = NULL};
+    }
+}
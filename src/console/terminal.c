@@ -1,30 +1,188 @@
 #include "../../include/console.h"
 //#include "../../include/gamecore.h"
 #include "../../include/utilities.h"
+#include "../../include/render.h"
+#include "../../include/output.h"
+#include "../../include/input.h"
+#include "../../include/events.h"
+#include "../../include/layout.h"
+#include "../../include/template.h"
+#include "../../include/crash.h"
 
 struct termios default_term_attr;
+static bool alt_screen = false;
+
+
+/**
+ * @returns The length of the reply of the terminal starting the bytes, a device attributes reply '\033[?<params>c'
+ *          or a DECRPM reply '\033[?<params>$y', otherwise 0
+ */
+static size_t reply_length(const char *bytes) {
+    if (strncmp(bytes, "\033[?", 3) != 0) {
+        return 0;
+    }
+    size_t end = 3;
+    while (isdigit((unsigned char)bytes[end]) || bytes[end] == ';') {
+        end++;
+    }
+    if (bytes[end] == 'c') {
+        return end + 1;
+    }
+    return bytes[end] == '$' && bytes[end + 1] == 'y' ? end + 2 : 0;
+}
+
+
+/**
+ * @brief This function asks the terminal whether it supports synchronized output (DEC mode 2026).
+ *        The DECRQM query is followed by a device attributes query that every terminal answers,
+ *        so a terminal that ignores DECRQM is detected without waiting on the timeout.
+ *        A terminal that answers neither is treated as unsupported once the timeout expires, & stdin is flushed
+ *        so a late reply isn't echoed (one arriving later still is dropped by the key decoder).
+ *        The keys typed while waiting are passed on to the input layer.
+ *
+ * @returns true if the terminal recognizes the mode, otherwise false
+ */
+static bool query_sync_support(void) {
+    if (!isatty(STDIN_FILENO) || !isatty(STDOUT_FILENO)) {
+        return false;
+    }
+
+    struct termios probe_tio = default_term_attr;
+    probe_tio.c_lflag &= ~(ICANON | ECHO);
+    probe_tio.c_cc[VMIN] = 0;
+    probe_tio.c_cc[VTIME] = 0;
+    if (tcsetattr(STDIN_FILENO, TCSANOW, &probe_tio) == VALUE_ERROR) {
+        return false;
+    }
+
+    out_printf("\033[?%i$p\033[c", SYNC_OUTPUT);
+    out_commit();
+
+    char reply[MIN_BUFF];
+    size_t len = 0;
+    bool answered = false;
+    while (!answered && len < sizeof(reply) - 1) {
+        struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN};
+        if (poll(&pfd, 1, PROBE_TIMEOUT) <= 0) {
+            break;
+        }
+        const ssize_t n = read(STDIN_FILENO, reply + len, sizeof(reply) - 1 - len);
+        if (n <= 0) {
+            break;
+        }
+        len += (size_t)n;
+        reply[len] = '\0';
+
+        //? The device attributes reply '\033[?<params>c' always comes last
+        for (const char *p = strstr(reply, "\033[?"); p != NULL && !answered; p = strstr(p + 1, "\033[?")) {
+            const size_t reply_len = reply_length(p);
+            answered = reply_len != 0 && p[reply_len - 1] == 'c';
+        }
+    }
+    if (!answered) {
+        tcflush(STDIN_FILENO, TCIFLUSH);
+    }
+    tcsetattr(STDIN_FILENO, TCSANOW, &default_term_attr);
+
+    //? Everything but the replies was typed by the user
+    char typed[MIN_BUFF];
+    size_t kept = 0;
+    for (size_t i = 0; i < len; i++) {
+        const size_t reply_len = reply_length(reply + i);
+        if (reply_len != 0) {
+            i += reply_len - 1;
+        } else {
+            typed[kept++] = reply[i];
+        }
+    }
+    input_push(typed, kept);
+
+    //? DECRPM reply : '\033[?2026;<state>$y', state 0 (unknown) & 4 (permanently reset) mean unsupported
+    char prefix[BUF_SIZE];
+    snprintf(prefix, sizeof(prefix), "\033[?%i;", SYNC_OUTPUT);
+    const char *rpm = len ? strstr(reply, prefix) : NULL;
+    if (rpm == NULL) {
+        return false;
+    }
+    const int state = atoi(rpm + strlen(prefix));
+    return state >= 1 && state <= 3;
+}
+
+
 /**
- * @brief This function stores the default attributes of the terminal to the above termios structure
+ * @brief This function stores the default attributes of the terminal to the above termios structure,
+ *        switches to the alternate screen so the scrollback of the user is left intact,
+ *        turns on bracketed paste so pasted text isn't taken for key presses,
+ *        switches the terminal to non-canonical mode for the whole game,
+ *        sets up the cell grid renderer that the screens draw into,
+ *        and centers its canvas on the terminal, placing it again on every resize
  */
 void initialize_terminal(void) {
     if (tcgetattr(STDIN_FILENO, &default_term_attr) == VALUE_ERROR) {
         perror("tcgetattr");
         exit(EXIT_FAILURE);
     }
+
+    out_printf("\033[?%ih\033[?%ih", ALT_SCREEN, PASTE_MODE);
+    out_commit();
+    alt_screen = true;
+
+    out_set_sync(query_sync_support());
+    if (!events_init()) {
+        log_error(__func__, __FILE__, __LINE__, "Event loop unavailable, signals are handled directly!...\n");
+    }
+    if (!input_init()) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to switch the terminal to non-canonical mode!...\n");
+    }
+    palette_init();
+    if (!render_init()) {
+        log_error(__func__, __FILE__, __LINE__, "Renderer unavailable, drawing straight to the terminal!...\n");
+    }
+    layout_init();
+}
+
+
+/**
+ * @brief This function sets up the game without a terminal, so the screens can be driven headlessly
+ *        (ie: by the render benchmark). The keys are read from stdin as they come, without switching it
+ *        to non-canonical mode, & the frames are presented to the given target. The canvas stays at the
+ *        top left corner, resizes aren't followed.
+ *
+ * @param target The target the frames are presented to
+ */
+void initialize_headless(const rtargets_t target) {
+    render_set_target(target);
+    if (!events_init()) {
+        log_error(__func__, __FILE__, __LINE__, "Event loop unavailable, signals are handled directly!...\n");
+    }
+    palette_init();
+    if (!render_init()) {
+        log_error(__func__, __FILE__, __LINE__, "Renderer unavailable, drawing straight to the output sink!...\n");
+    }
 }
 
 
 /**
  * @brief This Function restores the default attributes of the terminal after the program terminates
+ *        & returns to the main screen
  */
 void restore_terminal(void) {
-    tcsetattr(STDIN_FILENO, TCSANOW, &default_term_attr);
+    render_shutdown();
+    template_shutdown();
+
+    if (alt_screen) {
+        out_set_sync(false);
+        out_printf("\033[?%il\033[?%il", PASTE_MODE, ALT_SCREEN);
+        out_commit();
+        alt_screen = false;
+    }
+    input_restore();
 }
 
 
 /**
- * @brief This function handles the SIGSEGV/SIGINT signal (caused by pressing CTRL+C).
- *        It resets the terminal attributes back to default when SIGINT/SIGSEGV is received.
+ * @brief This function handles the SIGINT signal (caused by pressing CTRL+C), it is called by the event loop
+ *        outside of the signal context. It resets the terminal attributes back to default & exits.
  * @param signal signal
  */
 void signal_handler(const int signal) {
@@ -32,44 +190,35 @@ void signal_handler(const int signal) {
         log_error(__func__, __FILE__, __LINE__, "Program Abruptly terminated.\n");
         exit_program(EXIT_SUCCESS);
     }
-    if (signal == SIGSEGV) {
-        void *array[BUF_SIZE];
-        const size_t size = backtrace(array, BUF_SIZE);
-
-        log_error(__func__, __FILE__, __LINE__, "SIGNAL %i (Segmentation fault) received.\n", signal);
-
-        const int fd = open(ERROR_LOGPATH, O_WRONLY | O_CREAT | O_APPEND, 0644);
-        if (fd == VALUE_ERROR) {
-            log_error(__func__, __FILE__, __LINE__, "Error opening log file");
-            exit_program(EXIT_FAILURE);
-        }
-
-        dprintf(fd, "Error : signal %d (Segmentation fault) received.\n", signal);
-        backtrace_symbols_fd(array, size, fd);
-        close(fd);
-
-        exit_program(EXIT_FAILURE);
-    }
 }
 
 
 /**
- * @brief This function set's up and calls the 'signal_handler' function which listens for 'SIGINT'
+ * @brief This function set's up the signal handlers. 'signal_handler' listens for 'SIGINT' through the event loop,
+ *        & the crash reporter handles the fatal signals (SIGSEGV...) in the signal context.
  */
 void setup_signal_handler(void) {
-    if (signal(SIGINT, signal_handler) == SIG_ERR || signal(SIGSEGV, signal_handler) == SIG_ERR) {
+    //? Without the event loop, SIGINT is reported like a crash, the handler can't exit the program safely
+    if (!events_handle_signal(SIGINT, signal_handler) && !crash_handle(SIGINT)) {
         print("Error setting up signal handler");
         exit_program(EXIT_FAILURE);
     }
+    crash_init();
 }
 
 
 /**
- * @brief This function uses escape sequence '\033c', to reset
- *        the terminal to its initial state (ie: clear the terminal).
+ * @brief This function clears the back buffer of the renderer, the next present only sends the cells
+ *        that changed. Without the renderer, it homes the cursor & erases the screen, leaving the rest
+ *        of the terminal state alone (unlike a full reset '\033c', which makes terminals flicker).
 **/
 void clr_scr(void) {
-    print("\033c");
+    if (render_active()) {
+        render_clear();
+    }
+    else {
+        out_printf("\033[H\033[2J");
+    }
     set_console_cursor_mode(DISABLE);
 }
 
@@ -81,7 +230,11 @@ void clr_scr(void) {
  * @param y_coord Y-coordinate of the terminal
  */
 void set_console_cursor_position(const int x_coord, const int y_coord) {
-    print("\033[%i;%iH", y_coord, x_coord);
+    if (render_active()) {
+        render_move(x_coord, y_coord);
+        return;
+    }
+    out_printf("\033[%i;%iH", y_coord, x_coord);
 }
 
 
@@ -91,27 +244,54 @@ void set_console_cursor_position(const int x_coord, const int y_coord) {
  * @param mode Mode to determine whether to enable/disable the cursor
  */
 void set_console_cursor_mode(const int mode) {
-    print(mode == ENABLE ? "\033[?25h" : "\033[?25l");
+    if (render_active()) {
+        render_set_cursor_visible(mode == ENABLE);
+        return;
+    }
+    out_printf(mode == ENABLE ? "\033[?25h" : "\033[?25l");
 }
 
 
 /**
- * @brief This function sets the terminal foreground color to given rgb values
+ * @brief This function sends the precomputed SGR sequence selecting a cell color
  *
- * @param color rgb color code of the foreground
+ * @param color The cell color
+ * @param background true to set the background color, false for the foreground color
+ */
+static void emit_color(const uint32_t color, const bool background) {
+    size_t len;
+    const char *param = palette_param(color, background, &len);
+    out_write("\033[", 2);
+    out_write(param, len);
+    out_write("m", 1);
+}
+
+
+/**
+ * @brief This function sets the terminal foreground color to the given 256 color mode index
+ *
+ * @param color 256 color mode index of the foreground
  */
 void set_fg_color(const uint8_t color) {
-    print("\033[%i;%i;%hhum", FOREGROUND, BIT_MODE, color);
+    if (render_active()) {
+        render_set_fg(COLOR_INDEXED | color);
+        return;
+    }
+    emit_color(COLOR_INDEXED | color, false);
 }
 
 
 /**
- * @brief This function sets the terminal background color to given rgb values
+ * @brief This function sets the terminal background color to the given 256 color mode index
  *
- * @param color rgb color code of the background
+ * @param color 256 color mode index of the background
  */
 void set_bg_color(const uint8_t color) {
-    print("\033[%i;%i;%hhum", BACKGROUND, BIT_MODE, color);
+    if (render_active()) {
+        render_set_bg(COLOR_INDEXED | color);
+        return;
+    }
+    emit_color(COLOR_INDEXED | color, true);
 }
 
 
@@ -121,21 +301,25 @@ void set_bg_color(const uint8_t color) {
  * @param textStyle text mode/style
  */
 void set_console_text_attr(const int textStyle) {
+    if (render_active()) {
+        render_set_style(textStyle);
+        return;
+    }
     switch (textStyle) {
         case DIM :
-            print("\033[%im\033[%im", BOLD, DIM);
+            out_printf("\033[%im\033[%im", BOLD, DIM);
         break;
 
         case BOLD:
-            print("\033[%im", BOLD);
+            out_printf("\033[%im", BOLD);
         break;
 
         case INVERT :
-            print("\033[%im\033[%im", BOLD, INVERT);
+            out_printf("\033[%im\033[%im", BOLD, INVERT);
         break;
 
         default :
-            print("\033[%im", textStyle);
+            out_printf("\033[%im", textStyle);
         break;
     }
 }
@@ -147,8 +331,15 @@ void set_console_text_attr(const int textStyle) {
  * @param colors : rgb color set of the foreground and background
  */
 void set_console_color_attr(const RGBset_t colors) {
-    set_fg_color(rgb_256(colors.foreground));
-    set_bg_color(rgb_256(colors.background));
+    const uint32_t fg = palette_color(colors.foreground);
+    const uint32_t bg = palette_color(colors.background);
+    if (render_active()) {
+        render_set_fg(fg);
+        render_set_bg(bg);
+        return;
+    }
+    emit_color(fg, false);
+    emit_color(bg, true);
 }
 
 
@@ -157,11 +348,13 @@ void set_console_color_attr(const RGBset_t colors) {
  * @param n The number of characters to delete
  */
 void del_char(const size_t n) {
+    if (render_active()) {
+        render_backspace(n);
+        return;
+    }
     for (size_t i = 0; i < n; i++) {
         //? Move back one character, Overwrite it with a space, then move back again to position it correctly
-        putchar('\b');
-        putchar(' ');
-        putchar('\b');
+        out_write("\b \b", 3);
     }
 }
 
@@ -229,54 +422,3 @@ int get_win_size(int *rows, int *cols) {
 
     return VALUE_SUCCESS;
 }
-
-
-/**
- * @brief This function detects whenever the window is resized and exits if the size is
- *        less than the minimum height and width oof the terminal window
- *
- * @param sig no use
- */
-void handle_sigwinch(const int sig) {
-    (void)sig;
-    int rows, cols;
-
-    if (get_win_size(&rows, &cols) == IOCTL_ERROR) {
-        print("\n Failed to get win size!...");
-        exit_program(EXIT_FAILURE);
-    }
-
-    if (rows <= MIN_WIN_HEIGHT || cols <= MIN_WIN_WIDTH) {
-        log_error(__func__, __FILE__, __LINE__, "The program can only run on %i terminal width and %i height!...", MIN_WIN_WIDTH, MIN_WIN_HEIGHT);
-        clr_scr();
-        mvprint(1, 3, BOLD, "PROGRAM TERMINATED : \n\t MAKE SURE THE TERMINAL IS OPEN IN FULL SCREEN\n");
-        cgetch();
-        exit_program(EXIT_FAILURE);
-    }
-}
-
-
-/**
- * @brief THis function sets up the sigwinch handler and set the appropriate value for the offset position of the box
- *
- * @param offset_pos The variable to hold the offset position of the box to be printed
- */
-void setup_sigwinch_handler(int *offset_pos) {
-    struct sigaction sa;
-    sa.sa_handler = handle_sigwinch;
-    sa.sa_flags = 0;
-    sigemptyset(&sa.sa_mask);
-    sigaction(SIGWINCH, &sa, NULL);
-
-    int rows, cols;
-    if (get_win_size(&rows, &cols) == IOCTL_ERROR) {
-        print("\n Failed to get win size!...");
-        exit_program(EXIT_FAILURE);
-    }
-
-    *offset_pos = (cols - MIN_BOX_WIDTH) / 2;
-    if (rows <= MIN_WIN_HEIGHT || cols <= MIN_WIN_WIDTH) {
-        log_error(__func__, __FILE__, __LINE__, "The program can only run on %i terminal width and %i height!...", MIN_WIN_WIDTH, MIN_WIN_HEIGHT);
-        exit_program(EXIT_FAILURE);
-    }
-}
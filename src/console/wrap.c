@@ -0,0 +1,162 @@
+#include "../../include/wrap.h"
+#include "../../include/width.h"
+#include "../../include/utilities.h"
+
+
+// TODO : A slot of the cache of wrapped texts
+typedef struct WRAP_ENTRY {
+    bool      used;
+    int       id;
+    uint32_t  hash;     //? Hash of the text, texts of different tables can share an id
+    wrapped_t wrapped;
+} wentry_t;
+
+static wentry_t cache[WRAP_CACHE];
+
+//? Ellipsis marking a clipped text
+static const char ELLIPSIS[] = "…";
+
+
+/**
+ * @returns The FNV-1a hash of a null-terminated text
+ */
+static uint32_t hash_text(const char *text) {
+    uint32_t hash = 2166136261U;
+    for (const unsigned char *s = (const unsigned char *)text; *s != NULL_TERM; s++) {
+        hash = (hash ^ *s) * 16777619U;
+    }
+    return hash;
+}
+
+
+/**
+ * @brief This function word-wraps a text to a number of display columns. Lines break at spaces & newlines,
+ *        a word wider than a line is split between characters. Spaces around the breaks are dropped.
+ *
+ * @param text A pointer to the null-terminated text
+ * @param width The number of columns of a line
+ * @param wrapped A pointer to the struct receiving the lines
+ *
+ * @returns The number of lines
+ */
+size_t wrap_text(const char *text, const size_t width, wrapped_t *wrapped) {
+    *wrapped = (wrapped_t){.count = 0, .width = width, .clipped = false};
+    const size_t len = text != NULL ? strnlen(text, UINT16_MAX) : 0;
+    if (width == 0) {
+        wrapped->clipped = len > 0;
+        return 0;
+    }
+
+    size_t pos = 0;
+    while (pos < len && text[pos] == SPACE_BAR) {
+        pos += 1;
+    }
+
+    while (pos < len && wrapped->count < WRAP_LINES) {
+        size_t i = pos, used = 0, space = 0;
+        bool has_space = false;
+
+        while (i < len && text[i] != ENTER_KEY) {
+            uint32_t cp;
+            const size_t n = width_decode(text + i, len - i, &cp);
+            const size_t w = (size_t)width_codepoint(cp);
+            if (used + w > width) {
+                break;
+            }
+            if (cp == SPACE_BAR) {
+                space = i;
+                has_space = true;
+            }
+            used += w;
+            i += n;
+        }
+
+        size_t end = i, next = i;
+        if (i >= len || text[i] == ENTER_KEY) {
+            next = i < len ? i + 1 : i;
+        }
+        else if (text[i] == SPACE_BAR) {
+            next = i + 1;
+        }
+        else if (has_space) {
+            end = space;
+            next = space + 1;
+        }
+        else if (i == pos) {
+            //? A single character wider than the line still takes a line of its own
+            uint32_t cp;
+            end = next = i + width_decode(text + i, len - i, &cp);
+        }
+
+        while (end > pos && text[end - 1] == SPACE_BAR) {
+            end -= 1;
+        }
+        wrapped->lines[wrapped->count++] = (wline_t){.start = (uint16_t)pos, .len = (uint16_t)(end - pos)};
+
+        pos = next;
+        while (pos < len && text[pos] == SPACE_BAR) {
+            pos += 1;
+        }
+    }
+
+    wrapped->clipped = pos < len;
+    return wrapped->count;
+}
+
+
+/**
+ * @brief This function gives the wrapped lines of a text from the cache, wrapping it only on a miss
+ *
+ * @param id The id of the text (ie: the id of a question, a negative value for its choices)
+ * @param text A pointer to the null-terminated text
+ * @param width The number of columns of a line
+ *
+ * @returns A pointer to the wrapped lines, valid until the slot is taken by another text
+ */
+const wrapped_t *wrap_cached(const int id, const char *text, const size_t width) {
+    const uint32_t hash = hash_text(text);
+    const size_t slot = (hash ^ (uint32_t)id * 2654435761U ^ (uint32_t)width) & (WRAP_CACHE - 1);
+
+    wentry_t *entry = &cache[slot];
+    if (!entry->used || entry->id != id || entry->hash != hash || entry->wrapped.width != width) {
+        entry->used = true;
+        entry->id = id;
+        entry->hash = hash;
+        wrap_text(text, width, &entry->wrapped);
+    }
+    return &entry->wrapped;
+}
+
+
+/**
+ * @brief This function prints wrapped lines one below the other. If they don't all fit in 'max_lines' lines,
+ *        the last line printed ends with an ellipsis.
+ *
+ * @param x X-coordinate of the first line
+ * @param y Y-coordinate of the first line
+ * @param style The text style of the lines
+ * @param text A pointer to the text the lines were wrapped from
+ * @param wrapped A pointer to the wrapped lines
+ * @param max_lines The number of lines available
+ *
+ * @returns The number of lines printed
+ */
+size_t wrap_print(const int x, const int y, const int style, const char *text, const wrapped_t *wrapped,
+                  const size_t max_lines) {
+    const size_t count = wrapped->count < max_lines ? wrapped->count : max_lines;
+    const bool clipped = wrapped->clipped || wrapped->count > max_lines;
+
+    for (size_t i = 0; i < count; i++) {
+        const char *line = text + wrapped->lines[i].start;
+        size_t len = wrapped->lines[i].len;
+
+        if (clipped && i == count - 1) {
+            len = width_fit(line, len, wrapped->width - 1, NULL);
+            mvprint(x, y + (int)i, style, "%.*s%s", (int)len, line, ELLIPSIS);
+        }
+        else {
+            mvprint(x, y + (int)i, style, "%.*s", (int)len, line);
+        }
+    }
+    return count;
+}
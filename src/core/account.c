@@ -1,6 +1,7 @@
 #include "../../include/console.h"
 #include "../../include/db.h"
 #include "../../include/gamecore.h"
+#include "../../include/scene.h"
 
 
 /**
@@ -8,9 +9,12 @@
  *        It reads input from user, checks if the given details meet the requirements
  *        then finalizes the registration process and store the data to the database
  *
- * @param box_offset offset position value of the box to be printed in the terminal
+ * @param session A pointer to the state of the game session
+ *
+ * @returns The transition to the login scene
  **/
-void signup(const int box_offset) {
+transition_t signup(session_t *session) {
+    const int box_offset = session->box_offset;
     const int y_coord = 1;
     const int x_coord = box_offset;
 
@@ -85,21 +89,44 @@ void signup(const int box_offset) {
     free(newUser);
     free(newPlayer);
     cgetch();
-    login(box_offset);
+    return scene_replace(SCENE_LOGIN);
+}
+
+
+// TODO : Arguments of the authentication task
+typedef struct AUTH_TASK {
+    const char *username;
+    const char *password;
+    pstats_t   *player;
+} auth_t;
+
+
+/**
+ * @brief This function hashes the password & loads the player record, it runs on the thread of a task
+ *
+ * @param task A pointer to the task
+ * @param context A pointer to the 'auth_t' arguments
+ *
+ * @returns true if the credentials are valid, otherwise false
+ */
+static bool authenticate_task(task_t *task, void *context) {
+    (void)task;
+    const auth_t *auth = context;
+    return authenticate_player(auth->username, auth->password, auth->player);
 }
 
 
 /**
  * @brief Handles the login process, prompting users to enter their credentials.
  *
- * @param box_offset offset position value of the box to be printed in the terminal
+ * @param session A pointer to the state of the game session, receiving the player who logs in
+ *
+ * @returns The transition to the main menu, or back to the homepage after too many attempts
  */
-void login(const int box_offset) {
-    pstats_t *player = calloc(1, sizeof(pstats_t));
-    if (player == NULL) {
-        log_error(__func__, __FILE__, __LINE__, "calloc() : %s\n", strerror(ENOMEM));
-        exit_program(EXIT_FAILURE);
-    }
+transition_t login(session_t *session) {
+    const int box_offset = session->box_offset;
+    pstats_t *player = &session->player;
+    struct_memset(player, sizeof(pstats_t));
 
     const int x_coord = box_offset, y_coord = 1;
     //? Temp variable to store the uname and passwd
@@ -130,9 +157,12 @@ void login(const int box_offset) {
                 " %s Enter your password : ", LOGIN_EMOJI);
         get_pass(NULL, __passwd__, PASS_SIZE);
 
-        display_loader(x_coord + PROMPT_PADDING + 2, y_coord + HEADER_HEIGHT + 5, "Checking!...");
+        //? Verify the credentials & load the player record in one round trip, on a background thread
+        const auth_t auth = {.username = __uname__, .password = __passwd__, .player = player};
+        task_t task;
+        task_start(&task, authenticate_task, (void *)&auth);
 
-        if (!is_login_valid(__uname__, __passwd__)) {
+        if (!display_loader(x_coord + PROMPT_PADDING + 2, y_coord + HEADER_HEIGHT + 5, "Checking!...", &task)) {
             print_error(x_coord + PROMPT_PADDING + 2, y_coord + HEADER_HEIGHT + 6, "Incorrect Username/password, Try Again : ");
             check += 1;
             cgetch();
@@ -146,44 +176,40 @@ void login(const int box_offset) {
         print_error(x_coord + PROMPT_PADDING + 2, y_coord + HEADER_HEIGHT + 8,
                     "Too many login attempts : %s!...", strerror(ECANCELED));
         cgetch();
-    }
-    else {
-        print_success(x_coord + PROMPT_PADDING + 2, y_coord + HEADER_HEIGHT + 8,
-                      "Login Successful!... Press any key to go to the main menu : ");
-
         struct_memset(player, sizeof(pstats_t));
-        get_player_data(__uname__, player);
-        cgetch();
-        mainmenu(box_offset, player);
+        return scene_return(SCENE_HOMEPAGE);
     }
-    free(player);
-    homepage(box_offset);
+
+    print_success(x_coord + PROMPT_PADDING + 2, y_coord + HEADER_HEIGHT + 8,
+                  "Login Successful!... Press any key to go to the main menu : ");
+    cgetch();
+    return scene_replace(SCENE_MAINMENU);
 }
 
 
 /**
- * @brief This function logs out the current user session by deallocating
- *        the memory then redirecting to homepage
+ * @brief This function logs out the current user session by clearing
+ *        the player data & the questions prefetched for their next game, then redirecting to homepage
  *
- * @param box_offset
- * @param Session A pointer to the user account structure
+ * @param session A pointer to the state of the game session
+ *
+ * @returns The transition back to the homepage
  */
-void logout(const int box_offset, void *Session) {
-    if (Session) {
-        struct_memset(Session, sizeof(Session));
-        free(Session);
-        homepage(box_offset);
-    }
+transition_t logout(session_t *session) {
+    prefetch_discard();
+    struct_memset(&session->player, sizeof(pstats_t));
+    return scene_return(SCENE_HOMEPAGE);
 }
 
 
 /**
  * @brief This function manages the player account by calling either the edit or delete function
  *
- * @param box_offset offset position value of the box to be printed in the terminal
- * @param player A pointer to the current player structure
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition to the chosen scene
  */
-void manage_account(const int box_offset, pstats_t *player) {
+transition_t manage_account(session_t *session) {
     char menu[][BUF_SIZE] = {
         "MODIFY ACCOUNT",
         "DELETE ACCOUNT",
@@ -197,36 +223,23 @@ void manage_account(const int box_offset, pstats_t *player) {
         const char *heading = " QUIZBIT ━━ MANAGE ACCOUNT ";
         const size_t size = sizeof(menu)/sizeof(menu[0]);
 
-        display_main_page(box_offset, highlight, size, player, heading, NULL, emojis, menu);
+        display_main_page(session->box_offset, highlight, size, &session->player, heading, NULL, emojis, menu);
 
         set_console_text_attr(BOLD);
-        const int c = cgetch();
-        if (c == ENTER_KEY) {
+        if (read_menu_keys(size, &highlight)) {
             switch (highlight) {
                 case EDITACCOUNT :
-                    modify_account(box_offset, EDITACCOUNT, player);
-                    break;
-
                 case DELETEACCOUNT :
-                    modify_account(box_offset, DELETEACCOUNT, player);
-                    break;
-
                 case RESETACCOUNT :
-                    modify_account(box_offset, RESETACCOUNT, player);
-                    break;
+                    session->mode = highlight;
+                    return scene_push(SCENE_MODIFY_ACCOUNT);
 
                 case MAINMENU :
-                    mainmenu(box_offset, player);
-                    break;
+                    return scene_return(SCENE_MAINMENU);
 
                 default:
                     break;
             }
-            break;
-        }
-        const int arrow_key = get_arrow_key(c);
-        if (arrow_key != VALUE_ERROR) {
-            highlight = highlight_line(arrow_key, size, highlight);
         }
     } while (true);
 }
@@ -236,11 +249,14 @@ void manage_account(const int box_offset, pstats_t *player) {
  * @brief This function calls the delete, edit, or reset account functions based on the status of the 'mode' variable
  *        The function is called in the 'manage account' function above
  *
- * @param box_offset Offset position value of the box to be printed
- * @param mode mode to determine which function to call
- * @param player A pointer to the player stats structure
+ * @param session A pointer to the state of the game session, its mode determines which function to call
+ *
+ * @returns The transition to the chosen scene, to the settings if the player changed their mind,
+ *          or to the homepage if the password is incorrect
  */
-void modify_account(const int box_offset, const int mode, pstats_t *player) {
+transition_t modify_account(session_t *session) {
+    const int box_offset = session->box_offset, mode = session->mode;
+    pstats_t *player = &session->player;
     const int x_coord = box_offset, y_coord = 1;
 
     char heading[BUF_SIZE];
@@ -254,7 +270,7 @@ void modify_account(const int box_offset, const int mode, pstats_t *player) {
     print_error(x_coord + 8, y_coord + HEADER_HEIGHT + 4,
                 " This action is irreversible. Are you sure you want to continue? [Y/N] : ");
     if (get_confirmation(NULL) == 'N') {
-        settings(box_offset, player);
+        return scene_return(SCENE_SETTINGS);
     }
 
     char passwd[KEY_SIZE];
@@ -262,23 +278,20 @@ void modify_account(const int box_offset, const int mode, pstats_t *player) {
     get_pass(NULL, passwd, KEY_SIZE);
     if (!is_login_valid(player->profile.username, passwd)) {
         print_error(x_coord + 8, y_coord + HEADER_HEIGHT + 7, "Incorrect password, Logging out... : ");
-        free(player);
         delay(2000); //? sleep for 2 seconds
-        homepage(box_offset);
+        return logout(session);
     }
 
     if (mode == EDITACCOUNT) {
-        edit_account(box_offset, player);
+        return scene_replace(SCENE_EDIT_ACCOUNT);
     }
-    else if (mode == DELETEACCOUNT) {
-        delete_account(box_offset, player);
+    if (mode == DELETEACCOUNT) {
+        return scene_replace(SCENE_DELETE_ACCOUNT);
     }
-    else if (mode == RESETACCOUNT) {
-        reset_account_data(box_offset, player);
-    }
-    else {
-        mainmenu(box_offset, player);
+    if (mode == RESETACCOUNT) {
+        return scene_replace(SCENE_RESET_ACCOUNT);
     }
+    return scene_return(SCENE_MAINMENU);
 }
 
 
@@ -286,10 +299,14 @@ void modify_account(const int box_offset, const int mode, pstats_t *player) {
  * @brief This function allows the player to edit and update their account information,
  *        such as name, surname, username, or password.
  *
- * @param box_offset offset position value of the box to be printed in the terminal
- * @param player A pointer to the player stats structure.
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition to the main menu, or to the settings if the database can't be updated
  */
-void edit_account(const int box_offset, pstats_t *player) {
+transition_t edit_account(session_t *session) {
+    const int box_offset = session->box_offset;
+    pstats_t *player = &session->player;
+
     char fName[NAME_SIZE];
     char lName[NAME_SIZE];
     char uName[UNAME_SIZE];
@@ -354,8 +371,9 @@ void edit_account(const int box_offset, pstats_t *player) {
     sqlite3 *db = NULL;
     if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
         print_error(tmp_x, tmp_y += 2, "Error opening database : %s!...", sqlite3_errmsg(db));
+        sqlite3_close(db);
         cgetch();
-        mainmenu(box_offset, player);
+        return scene_return(SCENE_MAINMENU);
     }
 
     // TODO : Update the database for the fields that were editted
@@ -364,7 +382,7 @@ void edit_account(const int box_offset, pstats_t *player) {
             print_error(tmp_x, tmp_y + 2, "Failed to update database!...'see: errlog.txt'");
             sqlite3_close(db);
             cgetch();
-            settings(box_offset, player);
+            return scene_return(SCENE_SETTINGS);
         }
     }
 
@@ -373,7 +391,7 @@ void edit_account(const int box_offset, pstats_t *player) {
             print_error(tmp_x, tmp_y + 2, "Failed to update database!...'see: errlog.txt'");
             sqlite3_close(db);
             cgetch();
-            settings(box_offset, player);
+            return scene_return(SCENE_SETTINGS);
         }
     }
 
@@ -381,14 +399,16 @@ void edit_account(const int box_offset, pstats_t *player) {
         char *hashedPass = sha256_hashpass(passwd);
         if (hashedPass == NULL) {
             print_error(tmp_x, tmp_y + 2, "Error : %s to struct member!...", strerror(ENOMEM));
-            settings(box_offset, player);
+            sqlite3_close(db);
+            cgetch();
+            return scene_return(SCENE_SETTINGS);
         }
         else if (!update_player_data(db, "password", player->profile.username, hashedPass, "accounts")) {
             print_error(tmp_x, tmp_y + 2, "Failed to update database!...'see: errlog.txt'");
             sqlite3_close(db);
             cgetch();
             free(hashedPass);
-            settings(box_offset, player);
+            return scene_return(SCENE_SETTINGS);
         }
         else {
             free(hashedPass);
@@ -402,21 +422,21 @@ void edit_account(const int box_offset, pstats_t *player) {
             print_error(tmp_x, tmp_y + 2, "Failed to update database!...'see: errlog.txt'");
                 sqlite3_close(db);
                 cgetch();
-                settings(box_offset, player);
+                return scene_return(SCENE_SETTINGS);
         }
     }
     else { snprintf(uName, UNAME_SIZE, "%s", player->profile.username);}
+    sqlite3_close(db);
 
     print_success(tmp_x, tmp_y + 2, "Account updated successfully!... press any key to continue");
     struct_memset(player, sizeof(pstats_t));
     if (!get_player_data(uName, player)) {
         print_error(tmp_x, tmp_y + 4, "Failed to get updated data, please login again!...");
-        free(player);
         delay(2000);
-        logout(box_offset, player);
+        return logout(session);
     }
     cgetch();
-    mainmenu(box_offset, player);
+    return scene_return(SCENE_MAINMENU);
 }
 
 
@@ -448,10 +468,14 @@ ssize_t edit_field(const int x_coord, const int y_coord, const char *fieldName,
  * @brief This function allows the player to delete their account, removing all
  *        associated data from the players & users table in the database
  *
- * @param box_offset
- * @param player A pointer to the user player stats structure for the currently logged-in player.
+ * @param session A pointer to the state of the game session, holding the currently logged-in player.
+ *
+ * @returns The transition back to the homepage, or to the main menu if the database can't be opened
  */
-void delete_account(const int box_offset, pstats_t *player) {
+transition_t delete_account(session_t *session) {
+    const int box_offset = session->box_offset;
+    pstats_t *player = &session->player;
+
     const int x_coord = box_offset, y_coord = 1;
     const char *heading = " QUIZBIT ━━ DELETE ACCOUNT ";
 
@@ -462,14 +486,15 @@ void delete_account(const int box_offset, pstats_t *player) {
     sqlite3 *db = NULL;
     if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
         print_error(x_coord + 8, y_coord + HEADER_HEIGHT + 4, " [%s] Error opening database : %s!...\n", WARNING_EMOJI, sqlite3_errmsg(db));
+        sqlite3_close(db);
         cgetch();
-        mainmenu(box_offset, player);
+        return scene_return(SCENE_MAINMENU);
     }
 
     mvprint(x_coord + 10, y_coord + HEADER_HEIGHT + 4, BOLD, "[%s] Press any key to finalize account deletion process : ", INFO_EMOJI);
     cgetch();
 
-    if (delete_player_data(db, player, "accounts") &&
+    if (delete_game_results(db, player->profile.playerId) && delete_player_data(db, player, "accounts") &&
         delete_player_data(db, player, "players") && delete_player_data(db, player, "badges")) {
         print_success(x_coord + PROMPT_PADDING, y_coord + HEADER_HEIGHT + 6,
                     "Account deleted successfully!... Press any key to go back : ");
@@ -480,24 +505,29 @@ void delete_account(const int box_offset, pstats_t *player) {
     }
     sqlite3_close(db);
     delay(2000);
-    logout(box_offset, player);
+    return logout(session);
 }
 
 
 /**
  * @brief This function resets the currenty logged in players stats/data back to default
  *
- * @param box_offset offset position value of the box to be printed in the terminal
- * @param player A pointer to the player data to clear
+ * @param session A pointer to the state of the game session, holding the player data to clear
+ *
+ * @returns The transition to the main menu, or to the settings if the data can't be reset
  */
-void reset_account_data(const int box_offset, pstats_t *player) {
+transition_t reset_account_data(session_t *session) {
+    const int box_offset = session->box_offset;
+    pstats_t *player = &session->player;
+
     const int x_coord = box_offset, y_coord = HEADER_HEIGHT + 8;
     sqlite3 *db = NULL;
     if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE, NULL) != SQLITE_OK) {
         mvprint(x_coord + PROMPT_PADDING, y_coord, BOLD, " [%s] database error : check %s", WARNING_EMOJI, ERROR_LOGPATH);
         log_error(__func__, __FILE__, __LINE__, "%s\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
         delay(2000);
-        settings(box_offset, player);
+        return scene_return(SCENE_SETTINGS);
     }
 
     bool ret = true;
@@ -511,11 +541,16 @@ void reset_account_data(const int box_offset, pstats_t *player) {
                 " [%s] Failed to reset the values in the 'players' table", WARNING_EMOJI);
         ret = false;
     }
+    else if (!delete_game_results(db, player->profile.playerId)) {
+        mvprint(x_coord + PROMPT_PADDING, y_coord + 2, BOLD,
+                " [%s] Failed to reset the values in the 'games' table", WARNING_EMOJI);
+        ret = false;
+    }
     sqlite3_close(db);
 
     if (ret == false) {
         cgetch();
-        settings(box_offset, player);
+        return scene_return(SCENE_SETTINGS);
     }
 
     print_success(x_coord + PROMPT_PADDING, y_coord + 2,
@@ -527,11 +562,11 @@ void reset_account_data(const int box_offset, pstats_t *player) {
     if (!get_player_data(uName, player)) {
         print_error(x_coord + PROMPT_PADDING, y_coord + 4, "Failed to get updated data, please login again!...");
         delay(2000);
-        logout(box_offset, player);
+        return logout(session);
     }
 
     cgetch();
-    mainmenu(box_offset, player);
+    return scene_return(SCENE_MAINMENU);
 }
 
 
@@ -1,14 +1,18 @@
 #include "../../include/gamecore.h"
 #include "../../include/db.h"
+#include "../../include/scene.h"
+#include "../../include/width.h"
 
 
 /**
  * @brief This function displays the displays available options on the homepage.
  *        Users can choose to login, signup, play as guest, or exit the program.
  *
- * @param BOX_OFFSET Offset position value of the box
+ * @param session A pointer to the state of the game session
+ *
+ * @returns The transition to the chosen scene
  */
-void homepage(const int BOX_OFFSET) {
+transition_t homepage(session_t *session) {
     char menu[][BUF_SIZE] = {
         "LOG IN TO ACCOUNT ",
         "CREATE NEW ACCOUNT",
@@ -25,35 +29,25 @@ void homepage(const int BOX_OFFSET) {
         const char *heading = " QUIZBIT ━━ QUIZGAME ";
         const char *sub_heading = "60+ questions to challenge the level of your knowledge on different topics";
 
-        display_main_page(BOX_OFFSET, highlight, size, NULL, heading, sub_heading, emojis, menu);
+        display_main_page(session->box_offset, highlight, size, NULL, heading, sub_heading, emojis, menu);
 
-        const int c = cgetch();
-        if (c == ENTER_KEY) {
+        if (read_menu_keys(size, &highlight)) {
             switch (highlight) {
                 case LOGIN :
-                    login(BOX_OFFSET);
-                    break;
+                    return scene_push(SCENE_LOGIN);
 
                 case SIGNUP :
-                    signup(BOX_OFFSET);
-                    break;
+                    return scene_push(SCENE_SIGNUP);
 
                 case GUEST_MODE :
-                    guestplayer_mode(BOX_OFFSET);
-                    break;
+                    return scene_push(SCENE_GUEST_MODE);
 
                 case EXIT :
-                    exit_program(EXIT_SUCCESS);
-                    break;
+                    return scene_quit();
 
                 default:
                     break;
             }
-            break;
-        }
-        const int arrow_key = get_arrow_key(c);
-        if (arrow_key != VALUE_ERROR) {
-            highlight = highlight_line(arrow_key, size, highlight);
         }
     } while (true);
 }
@@ -62,10 +56,11 @@ void homepage(const int BOX_OFFSET) {
 /**
  * @brief This function displays the main menu options, including gameplay, help, settings, and logout.
  *
- * @param player A pointer to the user account structure representing the current player.
- * @param box_offset Offset value of the box to be printed
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition to the chosen scene
  */
-void mainmenu(const int box_offset, pstats_t *player) {
+transition_t mainmenu(session_t *session) {
     char menu[][BUF_SIZE] = {
         "START NEW GAME",
         "DISPLAY HELP",
@@ -78,35 +73,25 @@ void mainmenu(const int box_offset, pstats_t *player) {
     int highlight = 0;
     do {
         const char *heading = " QUIZBIT ━━ MAIN MENU ";
-        display_main_page(box_offset, highlight, size, player, heading, NULL, emojis, menu);
+        display_main_page(session->box_offset, highlight, size, &session->player, heading, NULL, emojis, menu);
 
-        const int c = cgetch();
-        if (c == ENTER_KEY) {
+        if (read_menu_keys(size, &highlight)) {
             switch (highlight) {
                 case GAMEPLAY :
-                    gameplay(box_offset, player);
-                    break;
+                    return scene_push(SCENE_GAMEPLAY);
 
                 case HELP :
-                    display_help(box_offset, player);
-                    break;
+                    return scene_push(SCENE_HELP);
 
                 case SETTINGS :
-                    settings(box_offset, player);
-                    break;
+                    return scene_push(SCENE_SETTINGS);
 
                 case LOGOUT :
-                    logout(box_offset, player);
-                    break;
+                    return logout(session);
 
                 default:
                     break;
             }
-            break;
-        }
-        const int arrow_key = get_arrow_key(c);
-        if (arrow_key != VALUE_ERROR) {
-            highlight = highlight_line(arrow_key, size, highlight);
         }
     } while (true);
 }
@@ -115,10 +100,11 @@ void mainmenu(const int box_offset, pstats_t *player) {
 /**
  * @brief This function displays menu options for game stats and account management utilities.
  *
- * @param player A pointer to the user account structure representing the current player.
- * @param box_offset Offset position value of the box
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition to the chosen scene
  */
-void settings(const int box_offset, pstats_t *player) {
+transition_t settings(session_t *session) {
     char menu[][BUF_SIZE] = {
         "VIEW LEADER BOARD",
         "VIEW PLAYER STATS",
@@ -131,35 +117,25 @@ void settings(const int box_offset, pstats_t *player) {
     int highlight = 0;
     do {
         const char *heading = " QUIZBIT ━━ SETTINGS ";
-        display_main_page(box_offset, highlight, size, player, heading, NULL, emojis, menu);
+        display_main_page(session->box_offset, highlight, size, &session->player, heading, NULL, emojis, menu);
 
-        const int c = cgetch();
-        if (c == ENTER_KEY) {
+        if (read_menu_keys(size, &highlight)) {
             switch (highlight) {
                 case LEADERBOARD :
-                    display_scoreboard(box_offset, player);
-                    break;
+                    return scene_push(SCENE_SCOREBOARD);
 
                 case STATISTICS :
-                    display_gamestats(box_offset, player);
-                    break;
+                    return scene_push(SCENE_GAMESTATS);
 
                 case MANAGEACCOUNT :
-                    manage_account(box_offset, player);
-                    break;
+                    return scene_push(SCENE_MANAGE_ACCOUNT);
 
                 case MAINMENU :
-                    mainmenu(box_offset, player);
-                    break;
+                    return scene_return(SCENE_MAINMENU);
 
                 default:
                     break;
             }
-            break;
-        }
-        const int arrow_key = get_arrow_key(c);
-        if (arrow_key != VALUE_ERROR) {
-            highlight = highlight_line(arrow_key, size, highlight);
         }
     } while (true);
 }
@@ -168,17 +144,15 @@ void settings(const int box_offset, pstats_t *player) {
 /**
  * @brief This function displays help/guide information on playing the game.
  *
- * @param player A pointer to the player's account structure.
- * @param box_offset Offset value of the box to be printed
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition back to the main menu
  */
-void display_help(const int box_offset, pstats_t *player) {
-    display_header(box_offset, " QUIZBIT ━━ GAMEPLAY HELP ", player);
+transition_t display_help(session_t *session) {
+    const int box_offset = session->box_offset;
+    display_header(box_offset, " QUIZBIT ━━ GAMEPLAY HELP ", &session->player);
 
-    const RGBset_t color = {
-        .foreground = {0, 0, 0},
-        .background = {255, 255, 255}
-    };
-    set_console_color_attr(color);
+    set_console_theme(THEME_HIGHLIGHT);
 
     int y = HEADER_HEIGHT + 4;
     const int x = box_offset + 5;
@@ -189,6 +163,8 @@ void display_help(const int box_offset, pstats_t *player) {
             "[%s] The game consists of 3 categories: science, sports, and general knowledge.", INFO_EMOJI);
     mvprint(x, y += 1, BOLD,
             "[%s] The system will randomly select questions from the chosen category.       ", INFO_EMOJI);
+    mvprint(x, y += 1, BOLD,
+            "[%s] Turn MARATHON on to play up to 500 questions in a row, [Q] ends the game. ", INFO_EMOJI);
     mvprint(x, y += 1, BOLD,
             "[%s] You can reset scores, edit & delete your account from the settings page.  ", INFO_EMOJI);
     mvprint(x, y += 1, BOLD,
@@ -202,55 +178,57 @@ void display_help(const int box_offset, pstats_t *player) {
         "[%s] Press any key to go back : ", BULLET_EMOJI);
     cgetch();
 
-    mainmenu(box_offset, player);
+    return scene_back();
 }
 
 
 /**
- * @brief Displays gameplay options, allowing the player to choose categories before starting the game.
+ * @brief Displays gameplay options, allowing the player to choose categories before starting the game,
+ *        & whether the game is a marathon.
  *
- * @param player A pointer to the user account structure representing the current player.
- * @param box_offset Offset value of the box to be printed
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition to the game of the chosen category, or back to the main menu.
+ *          The marathon toggle stays on the menu, the next games are marathons until it is toggled off
  */
-void gameplay(const int box_offset, pstats_t *player) {
+transition_t gameplay(session_t *session) {
     char menu[][BUF_SIZE] = {
         "SCIENCE TEST",
         "SPORTS TEST",
         "GENERAL KNOWLEDGE",
-        "MAIN MENU"
+        "MAIN MENU",
+        "MARATHON : OFF"
     };
     const size_t size = sizeof(menu)/sizeof(menu[0]);
-    char emojis[][BADGE_SIZE] = {SCIENCE_EMOJI, SPORTS_EMOJI, GLOBE_EMOJI, MENU_EMOJI};
+    char emojis[][BADGE_SIZE] = {SCIENCE_EMOJI, SPORTS_EMOJI, GLOBE_EMOJI, MENU_EMOJI, FIRE_EMOJI};
 
     int highlight = 0;
     do {
+        //? The toggle keeps its width, so the label is drawn over the last one
+        snprintf(menu[MARATHON], BUF_SIZE, "MARATHON : %s", session->marathon ? "ON " : "OFF");
         const char *heading = " QUIZBIT ━━ NEW GAME ";
         const char *sub_heading = "Select the game category you want to play : ";
-        display_main_page(box_offset, highlight, size, player, heading, sub_heading, emojis, menu);
+        display_main_page(session->box_offset, highlight, size, &session->player, heading, sub_heading, emojis, menu);
 
-        const int c = cgetch();
-        if (c == ENTER_KEY) {
+        if (read_menu_keys(size, &highlight)) {
             switch (highlight) {
                 case SCIENCE :
-                     display_questions(box_offset, player, "SCIENCE");
-                     break;
+                     session->category = "SCIENCE";
+                     return scene_replace(SCENE_QUESTIONS);
                 case SPORTS :
-                     display_questions(box_offset, player, "SPORTS");
-                     break;
+                     session->category = "SPORTS";
+                     return scene_replace(SCENE_QUESTIONS);
                 case GENERALKNOWLEDGE :
-                     display_questions(box_offset, player, "BASICS");
-                     break;
+                     session->category = "BASICS";
+                     return scene_replace(SCENE_QUESTIONS);
                 case MAINMENU :
-                     mainmenu(box_offset, player);
+                     return scene_back();
+                case MARATHON :
+                     session->marathon = !session->marathon;
                      break;
                 default:
                     break;
             }
-            break;
-        }
-        const int arrow_key = get_arrow_key(c);
-        if (arrow_key != VALUE_ERROR) {
-            highlight = highlight_line(arrow_key, size, highlight);
         }
     } while (true);
 }
@@ -259,9 +237,11 @@ void gameplay(const int box_offset, pstats_t *player) {
 /**
  * @brief This function calls the 'play as guest' feature for  users who don't want to signup/login to their account
  *
- * @param BOX_OFFSET Offset value of the box to be printed in the terminal window
+ * @param session A pointer to the state of the game session
+ *
+ * @returns The transition to the chosen scene
  */
-void guestplayer_mode(const int BOX_OFFSET) {
+transition_t guestplayer_mode(session_t *session) {
     char menu[][BUF_SIZE] = {
         "CONTINUE AS GUEST",
         "CREATE NEW ACCOUNT",
@@ -278,35 +258,25 @@ void guestplayer_mode(const int BOX_OFFSET) {
         const char *heading = " QUIZBIT ━━ GUEST MODE ";
         const char *sub_heading = "Inorder to get the full experience, signup for a new account!...";
 
-        display_main_page(BOX_OFFSET, highlight, size, NULL, heading, sub_heading, emojis, menu);
+        display_main_page(session->box_offset, highlight, size, NULL, heading, sub_heading, emojis, menu);
 
-        const int c = cgetch();
-        if (c == ENTER_KEY) {
+        if (read_menu_keys(size, &highlight)) {
             switch (highlight) {
                 case GUEST_PLAYER :
-                    play_as_guest(BOX_OFFSET);
-                break;
+                    return scene_push(SCENE_GUEST_GAME);
 
                 case SIGNUP :
-                    signup(BOX_OFFSET);
-                break;
+                    return scene_replace(SCENE_SIGNUP);
 
                 case HOMEPAGE :
-                    homepage(BOX_OFFSET);
-                break;
+                    return scene_back();
 
                 case EXIT :
-                    exit_program(EXIT_SUCCESS);
-                break;
+                    return scene_quit();
 
                 default:
                     break;
             }
-            break;
-        }
-        const int arrow_key = get_arrow_key(c);
-        if (arrow_key != VALUE_ERROR) {
-            highlight = highlight_line(arrow_key, size, highlight);
         }
     } while (true);
 }
@@ -338,10 +308,12 @@ void reset_score(const int box_offset, pstats_t *player) {
  * @brief This function displays the top five players with the highest scores from the database.
  *        The players are ranked in order of current score, which updates after every game.
  *
- * @param box_offset Offset position value of the box to be printed
- * @param player A pointer to the player's account structure.
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition back to the settings
  */
-void display_scoreboard(const int box_offset, pstats_t *player) {
+transition_t display_scoreboard(session_t *session) {
+    const int box_offset = session->box_offset;
     char query[MAX_BUFF];
     snprintf(query, sizeof(query),
     "SELECT player_id, current_score, average_score, highest_score FROM players ORDER BY current_score DESC LIMIT 5;");
@@ -350,14 +322,16 @@ void display_scoreboard(const int box_offset, pstats_t *player) {
     const char *heading = " QUIZBIT ━━ LEADERBOARD ";
 
     draw_box(x, y, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
-    display_header(box_offset, heading, player);
+    display_header(box_offset, heading, &session->player);
     display_footer(box_offset);
 
     sqlite3 *db = NULL;
     if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
         print_error(x + 7, y + HEADER_HEIGHT + 3,
                     " Error openning db : %s!...", sqlite3_errmsg(db));
-        settings(box_offset, player);
+        sqlite3_close(db);
+        cgetch();
+        return scene_back();
     }
 
     sqlite3_stmt *stmt = NULL;
@@ -366,13 +340,13 @@ void display_scoreboard(const int box_offset, pstats_t *player) {
                     " Error preparing statement : %s!...", sqlite3_errmsg(db));
         sqlite3_close(db);
         cgetch();
-        settings(box_offset, player);
+        return scene_back();
     }
     char sub_heading[BUF_SIZE];
     snprintf(sub_heading, sizeof(sub_heading), "%s Top Five Players Ranked On The Scoreboard", PAGE_EMOJI);
 
     const int tmp_y = y + HEADER_HEIGHT + 4;
-    int padding = get_padding(strlen(sub_heading) - 2);
+    int padding = get_padding(width_str(sub_heading));
     mvprint(x + padding, tmp_y, BOLD, "%s", sub_heading);
 
     char content[MIN_BUFF] = {0};
@@ -380,14 +354,25 @@ void display_scoreboard(const int box_offset, pstats_t *player) {
     snprintf(content, sizeof(content), " %s PLAYER ID  │ %s SCORE  │ %s AVG-SCORE  │ %s HIGH-SCORE  ",
             ID_EMOJI, SPORTS_EMOJI, BCHART_EMOJI, UCHART_EMOJI);
 
-    const size_t len = strlen(content) - 14;
+    const size_t len = width_str(content);
 
     padding = get_padding(len);
     mvprint(x + padding, tmp_y + 2, BOLD, "%s", content);
 
+    //? Columns of the separators, measured on the heading so the rows line up with it
+    int columns[BOARD_COLUMNS] = {0};
+    size_t count = 0;
+    for (const char *bar = strstr(content, VERTICAL_BAR); bar != NULL && count < BOARD_COLUMNS;
+         bar = strstr(bar + strlen(VERTICAL_BAR), VERTICAL_BAR)) {
+        columns[count++] = (int)width_text(content, (size_t)(bar - content));
+    }
+
     set_console_cursor_position(x + padding - 1, tmp_y + 3);
-    for (size_t i = 0; i <= len + 1; i++) {
-        if (i == 16 || i == 28 || i == 44) print("┼");
+    for (size_t i = 0, k = 0; i <= len + 1; i++) {
+        if (k < count && i == (size_t)columns[k] + 1) {
+            print("┼");
+            k += 1;
+        }
         else print("─");
     }
 
@@ -401,10 +386,13 @@ void display_scoreboard(const int box_offset, pstats_t *player) {
         mvprint(x + padding - 2, tmp_y + i + 3, BOLD, "%s",
             i == 1 ? GOLD_MEDAL : i == 2 ? SILVER_MEDAL : i == 3 ? BRONZE_MEDAL : MILITARY_MEDAL);
 
-        mvprint(x + padding + 01, tmp_y + i + 3, BOLD, "%s", playerid);
-        mvprint(x + padding + 15, tmp_y + i + 3, BOLD, "│   %04u", current_score);
-        mvprint(x + padding + 27, tmp_y + i + 3, BOLD, "│     %04u", average_score);
-        mvprint(x + padding + 43, tmp_y + i + 3, BOLD, "│     %04u", highest_score);
+        char cell[BUF_SIZE];
+        width_pad(cell, sizeof(cell), playerid, (size_t)columns[0] - 2, ALIGN_LEFT);
+
+        mvprint(x + padding + 1, tmp_y + i + 3, BOLD, "%s", cell);
+        mvprint(x + padding + columns[0], tmp_y + i + 3, BOLD, "│   %04u", current_score);
+        mvprint(x + padding + columns[1], tmp_y + i + 3, BOLD, "│     %04u", average_score);
+        mvprint(x + padding + columns[2], tmp_y + i + 3, BOLD, "│     %04u", highest_score);
 
         i += 1;
     }
@@ -414,17 +402,37 @@ void display_scoreboard(const int box_offset, pstats_t *player) {
     mvprint(x + 18, y + tmp_y + 12, BOLD, " [%s] Players are ranked inorder of current score {%s}", INFO_EMOJI, SPORTS_EMOJI);
     mvprint(x + 20, y + tmp_y + 13, BOLD, " [%s] press any key to go back : ", BULLET_EMOJI);
     cgetch();
-    settings(box_offset, player);
+    return scene_back();
+}
+
+
+/**
+ * @brief This function formats a percentile of the answer times of a player, in seconds
+ *
+ * @param buffer A pointer to the buffer receiving the time
+ * @param size The size of the buffer
+ * @param latency A pointer to the histogram of the answer times of the player
+ * @param fraction The percentile, between 0 & 1
+ */
+static void format_answer_time(char *buffer, const size_t size, const histogram_t *latency, const double fraction) {
+    if (latency->count == 0) {
+        snprintf(buffer, size, "N/A");
+        return;
+    }
+    snprintf(buffer, size, "%04.1fs", hist_percentile(latency, fraction) / 1000.0);
 }
 
 
 /**
  * @brief This function displays all the stats  & achievements of the currently logged-in player
  *
- * @param box_offset Offset position value of the box
- * @param player A pointer to the player stats structure
+ * @param session A pointer to the state of the game session, holding the current player
+ *
+ * @returns The transition back to the settings, or to the homepage if the player data can't be read
  */
-void display_gamestats(const int box_offset, pstats_t *player) {
+transition_t display_gamestats(session_t *session) {
+    const int box_offset = session->box_offset;
+    pstats_t *player = &session->player;
     const int x = box_offset, y = 1;
     const char *heading = " QUIZBIT ━━ PLAYERSTATS ";
 
@@ -436,7 +444,9 @@ void display_gamestats(const int box_offset, pstats_t *player) {
     if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
         print_error(x + 7, y + HEADER_HEIGHT + 3,
                     " Error openning db : %s!...", sqlite3_errmsg(db));
-        settings(box_offset, player);
+        sqlite3_close(db);
+        cgetch();
+        return scene_back();
     }
 
     char uname[UNAME_SIZE];
@@ -444,7 +454,8 @@ void display_gamestats(const int box_offset, pstats_t *player) {
     account_t *user = calloc(1, sizeof(account_t));
     if (user == NULL) {
         log_error(__func__, __FILE__, __LINE__, "calloc() : %s\n", strerror(ENOMEM));
-        settings(box_offset, player);
+        sqlite3_close(db);
+        return scene_back();
     }
 
     snprintf(uname, UNAME_SIZE, "%s", player->profile.username);
@@ -470,12 +481,19 @@ void display_gamestats(const int box_offset, pstats_t *player) {
                 "Failed to retrieve from 'badges' table : %s!...\n", sqlite3_errmsg(db));
         ret = false;
     }
+
+    //? The answer times are optional, the stats are shown without them
+    histogram_t latency;
+    if (!retrieve_player_latency(db, player->profile.playerId, &latency)) {
+        log_error(__func__, __FILE__, __LINE__,
+                "Failed to retrieve from 'player_latency' table : %s!...\n", sqlite3_errmsg(db));
+    }
     sqlite3_close(db);
 
     if (!ret) {
         print_error(x, y, "Error retrieving player data, quitting!... see errorlog.txt");
         free(user);
-        logout(box_offset, player);
+        return logout(session);
     }
 
     const int tmp_x = x, tmp_y = y + HEADER_HEIGHT;
@@ -511,8 +529,12 @@ void display_gamestats(const int box_offset, pstats_t *player) {
             HELP_EMOJI, player->answers.totalQuestionAttempted, GEMSTONE_EMOJI, player->treasure.totalGemStones);
     mvprint(tmp_x + 15, tmp_y + 13, BOLD, "%s PERFORMANCE RATE  : %03u%%  │  %s COMPLETION RATE   : %03u%%",
             PERCENT_EMOJI, player->stats.performanceRate, PERCENT_EMOJI, player->stats.quizCompletionRate);
-    mvprint(tmp_x + 15, tmp_y + 14, BOLD, "%s GAMES COMPLETED   : %04u  │",
-            NUMBERS_EMOJI, player->stats.totalGamesCompleted);
+    char p50[0x10], p90[0x10];
+    format_answer_time(p50, sizeof(p50), &latency, 0.50);
+    format_answer_time(p90, sizeof(p90), &latency, 0.90);
+    mvprint(tmp_x + 15, tmp_y + 14, BOLD, "%s GAMES COMPLETED   : %04u  │  %s P50 ANSWER TIME   : %s",
+            NUMBERS_EMOJI, player->stats.totalGamesCompleted, CLOCK_EMOJI, p50);
+    mvprint(tmp_x + 15 + 29, tmp_y + 15, BOLD, "│  %s P90 ANSWER TIME   : %s", CLOCK_EMOJI, p90);
 
     mvprint(tmp_x + 12, tmp_y + 17, BOLD, "%s",
         player->badge.perfectionist == UNLOCKED ? "PERFECTIONIST : " PERFECTIONIST_BADGE : "UNLOCKED BADGES : ");
@@ -544,5 +566,5 @@ void display_gamestats(const int box_offset, pstats_t *player) {
 
     mvprint(tmp_x + 20, tmp_y + 19, BOLD, " %s Press any key to go back to the main menu : ", BULLET_EMOJI);
     cgetch();
-    settings(box_offset, player);
+    return scene_back();
 }
\ No newline at end of file
@@ -3,6 +3,15 @@
 #include "../../include/gamemath.h"
 
 
+/**
+ * @returns The length of a game in seconds, scaled to a game of MAX_QUESTIONS questions,
+ *          so the time thresholds apply to the games of any length
+ */
+static double get_scaled_time(const gtiming_t *timing, const uint32_t count) {
+    return count > 0 ? timing_seconds(timing) * MAX_QUESTIONS / count : timing_seconds(timing);
+}
+
+
 /**
  * @brief This function calculates the new average score of the player after every quiz game
  *
@@ -64,11 +73,12 @@ uint32_t get_total_correct_answers(const uint32_t score) {
  * @brief This function calculates the total number of incorrectly answered questions
  *
  * @param score newly acquired score of the player after the quiz
+ * @param count The number of questions of the game
  *
- * @returns The total number of incorrect answers
+ * @returns The total number of incorrect answers, the skipped questions included
  */
-uint32_t get_total_incorrect_answers(const uint32_t score) {
-    return score > INITIAL_SCORE ? MAX_QUESTIONS - score / MAXIMUM_SCORE : MAX_QUESTIONS;
+uint32_t get_total_incorrect_answers(const uint32_t score, const uint32_t count) {
+    return score > INITIAL_SCORE ? count - score / MAXIMUM_SCORE : count;
 }
 
 
@@ -76,11 +86,12 @@ uint32_t get_total_incorrect_answers(const uint32_t score) {
  * @brief This function counts the total number of questions that were answered by the player
  *
  * @param skipped The number of questions that were skipped
+ * @param count The number of questions of the game
  *
  * @returns The total number of question attempted
  */
-uint32_t get_total_question_attempted(const uint32_t skipped) {
-    return MAX_QUESTIONS - skipped;
+uint32_t get_total_question_attempted(const uint32_t skipped, const uint32_t count) {
+    return count - skipped;
 }
 
 
@@ -113,12 +124,12 @@ uint32_t games_completed(const uint32_t skipped) {
  * @brief This function calculates the performance rate of the player after every game
  *
  * @param c_ans number of correct answers
- * @param g_played number of games played
+ * @param shown number of questions shown over every game played, whatever their length
  *
  * @returns the performance rate of the player
  */
-double get_performance_rate(const uint32_t c_ans, const uint32_t g_played) {
-    return (double)c_ans / (double)(MAX_QUESTIONS * g_played) * 100.00;
+double get_performance_rate(const uint32_t c_ans, const uint32_t shown) {
+    return shown > 0 ? (double)c_ans / (double)shown * 100.00 : 0.00;
 }
 
 
@@ -126,12 +137,12 @@ double get_performance_rate(const uint32_t c_ans, const uint32_t g_played) {
  * @brief This function calculated the quiz completion rate of the player
  *
  * @param q_attmpt Total number of questions attempted by the player
- * @param g_played Total number of games played/attempted
+ * @param shown Total number of questions shown over every game played/attempted
  *
  * @returns the rate of completion of the player
  */
-double get_completion_rate(const uint32_t q_attmpt, const uint32_t g_played) {
-    return (double)q_attmpt / (double)(MAX_QUESTIONS * g_played) * 100.00;
+double get_completion_rate(const uint32_t q_attmpt, const uint32_t shown) {
+    return shown > 0 ? (double)q_attmpt / (double)shown * 100.00 : 0.00;
 }
 
 
@@ -140,13 +151,14 @@ double get_completion_rate(const uint32_t q_attmpt, const uint32_t g_played) {
  *        updated when a player achieves 90% or more in a game
  *
  * @param new_score The newly acquired score of the player after the game
+ * @param count The number of questions of the game
  * @param old_streak The current streak value of the player
  *
- * @returns 1 if player achieves a score >= 90 else returns the current streak
+ * @returns 1 if player achieves a score >= 90% else returns the current streak
  */
-uint32_t get_lstreaks(const uint32_t new_score, const uint32_t old_streak) {
-    const uint32_t new_streak = MAXIMUM_SCORE * (MAX_QUESTIONS - 1);
-    if (new_score >= new_streak) {
+uint32_t get_lstreaks(const uint32_t new_score, const uint32_t count, const uint32_t old_streak) {
+    const uint32_t new_streak = (uint32_t)get_percentage(90, count * MAXIMUM_SCORE);
+    if (count > 0 && new_score >= new_streak) {
         return 1;
     }
     return old_streak;
@@ -161,11 +173,13 @@ uint32_t get_lstreaks(const uint32_t new_score, const uint32_t old_streak) {
  * @param bonus Bonus score acquired based on the performance of the player
  * @param new_score Newly acquired score of the player
  * @param skipped The number of questions that were skipped during the quiz game
- * @param __time_ The elapsed time if the quiz game
+ * @param count The number of questions of the quiz game, MAX_QUESTIONS or the length of a marathon
+ * @param timing A pointer to the timing of the quiz game
  */
-void getnew_playerstats(pstats_t *player, const uint32_t score, const uint32_t bonus, const uint32_t new_score, const uint32_t skipped, const double __time_) {
+void getnew_playerstats(pstats_t *player, const uint32_t score, const uint32_t bonus, const uint32_t new_score,
+                        const uint32_t skipped, const uint32_t count, const gtiming_t *timing) {
     player->stats.totalGamesPlayed += 1;
-    player->answers.totalQuestionAttempted += get_total_question_attempted(skipped);
+    player->answers.totalQuestionAttempted += get_total_question_attempted(skipped, count);
 
     const uint32_t tmp_new_score = bonus + new_score;
     player->scores.highestScore = get_highest_score(score, tmp_new_score);
@@ -173,19 +187,19 @@ void getnew_playerstats(pstats_t *player, const uint32_t score, const uint32_t b
     player->scores.averageScore = get_average_score(tmp_avg, tmp_new_score, player->stats.totalGamesPlayed);
 
     player->answers.totalCorrectAnswers += get_total_correct_answers(new_score);
-    player->answers.totalIncorrectAnswers += get_total_incorrect_answers(new_score);
+    player->answers.totalIncorrectAnswers += get_total_incorrect_answers(new_score, count);
 
-    const uint32_t tmp = get_lstreaks(new_score, player->stats.longestStreak);
+    const uint32_t tmp = get_lstreaks(new_score, count, player->stats.longestStreak);
     player->stats.longestStreak = tmp == 1 ? player->stats.longestStreak + tmp : NIL;
 
     player->stats.timeSpentPerGame =
-        get_average_time(player->stats.timeSpentPerGame, __time_, player->stats.totalGamesPlayed);
+        get_average_time(player->stats.timeSpentPerGame, timing_seconds(timing), player->stats.totalGamesPlayed);
 
+    //? Every question shown is either answered correctly or counted as incorrect, the skipped ones included
+    const uint32_t shown = player->answers.totalCorrectAnswers + player->answers.totalIncorrectAnswers;
     player->stats.totalGamesCompleted += games_completed(skipped);
-    player->stats.performanceRate =
-        (uint32_t)get_performance_rate(player->answers.totalCorrectAnswers, player->stats.totalGamesPlayed);
-    player->stats.quizCompletionRate =
-        (uint32_t)get_completion_rate(player->answers.totalQuestionAttempted, player->stats.totalGamesPlayed);
+    player->stats.performanceRate = (uint32_t)get_performance_rate(player->answers.totalCorrectAnswers, shown);
+    player->stats.quizCompletionRate = (uint32_t)get_completion_rate(player->answers.totalQuestionAttempted, shown);
 }
 
 
@@ -194,14 +208,15 @@ void getnew_playerstats(pstats_t *player, const uint32_t score, const uint32_t b
  *
  * @param player A pointer to the currently logged in player stats structure
  * @param score Newly acquired score of the player including the bonus
- * @param time Elapsed time of the quiz
+ * @param count The number of questions of the quiz
+ * @param timing A pointer to the timing of the quiz
  */
-void unlock_achievements(pstats_t *player, const uint32_t score, const double time) {
+void unlock_achievements(pstats_t *player, const uint32_t score, const uint32_t count, const gtiming_t *timing) {
     if (player->stats.totalGamesPlayed >= 5) {
         player->badge.starter = UNLOCKED;
     }
 
-    const uint32_t percentage = (uint32_t)get_percentage(90, MAX_QUESTIONS * MAXIMUM_SCORE);
+    const uint32_t percentage = (uint32_t)get_percentage(90, count * MAXIMUM_SCORE);
     if (score >= percentage) {
         if (player->stats.longestStreak >= 25) {
             player->badge.glowingStar = UNLOCKED;
@@ -212,10 +227,10 @@ void unlock_achievements(pstats_t *player, const uint32_t score, const double ti
         }
     }
 
-    if (score == MAX_QUESTIONS * MAXIMUM_SCORE) {
+    if (count > 0 && score == count * MAXIMUM_SCORE) {
         player->badge.hundredPoints = UNLOCKED;
 
-        if (time < LSTREAK_TTHRESHOLD) {
+        if (get_scaled_time(timing, count) < LSTREAK_TTHRESHOLD) {
             player->badge.rocket = UNLOCKED;
             player->treasure.totalMoneyBags += 5;
             player->treasure.totalGoldCoins += 10;
@@ -283,24 +298,27 @@ double get_time_difference(const char *old_time, const char *new_time) {
 /**
  * @brief This function assigns bonus to players after the quiz challenge have been completed
  *        It only assign bonus to players that have correctly answered atleast half of the questions
+ *        The time thresholds are for a game of MAX_QUESTIONS, a longer game gets proportionally more time.
  *
  * @param score A variable holding the score of the player
- * @param time A variable holding the elapsed time during the game
+ * @param count The number of questions of the game
+ * @param timing A pointer to the timing of the game
  *
  * @returns The bonus acquired
  */
-uint32_t assign_bonus(const uint32_t score, const double time) {
-    if (score < MAXIMUM_SCORE * MAX_QUESTIONS / 2) {
+uint32_t assign_bonus(const uint32_t score, const uint32_t count, const gtiming_t *timing) {
+    if (count == 0 || score < MAXIMUM_SCORE * count / 2) {
         return NIL;
     }
+    const double time = get_scaled_time(timing, count);
 
     //? Assign bonus to players that correctly answered atleast half of the questions
-    const uint32_t bonus = score / MAX_QUESTIONS;
+    const uint32_t bonus = score / count;
     if (time > HIGH_TIME_THRESHOLD) {
         return bonus + BONUS_LOW;
     }
     if (time <= LOW_TIME_THRESHOLD) {
-        if (score == MAX_QUESTIONS * MAXIMUM_SCORE) {
+        if (score == count * MAXIMUM_SCORE) {
             return (bonus + BONUS_HIGH) * 2; //? twice the bonus for players that scored 100% within 120 seconds
         }
         return bonus + BONUS_HIGH;
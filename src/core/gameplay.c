@@ -1,232 +1,1057 @@
+#include <strings.h>
+
 #include "../../include/db.h"
 #include "../../include/utilities.h"
+#include "../../include/width.h"
+#include "../../include/wrap.h"
+#include "../../include/scene.h"
+
+
+//? Draws of the sampler per question, before it probes short ranges of ids instead
+#define SAMPLE_TRIES 0x10
+//? Ids read by a probe, & probes per question before a seen question is drawn again
+#define PROBE_ROWS   0x10
+#define PROBE_TRIES  0x04
 
 
 /**
- * @brief This function reads 10 random questions along with their choices, from the given table in the database
+ * @brief This function reads a question along with its choices, by its id
+ *
+ * @param stmt A pointer to the statement selecting a question by its id
+ * @param id The id of the question
+ * @param quiz A pointer to the quiz_t structure to store the question
+ * @param found A pointer set to whether the table has a question with that id
+ *
+ * @returns true if the question is read or there is none with that id, otherwise false.
+ */
+static bool read_question(sqlite3_stmt *stmt, const uint32_t id, quiz_t *quiz, bool *found) {
+    sqlite3_reset(stmt);
+    if (sqlite3_bind_int(stmt, 1, (int)id) != SQLITE_OK) {
+        return false;
+    }
+    const int rc = sqlite3_step(stmt);
+    *found = rc == SQLITE_ROW;
+    if (!*found) {
+        return rc == SQLITE_DONE;
+    }
+    quiz->question_id = sqlite3_column_int(stmt, 0);
+
+    const unsigned char *question = sqlite3_column_text(stmt, 1);
+    if (strlen((const char*)question) >= QUESTION_SIZE) {
+        log_error(__func__, __FILE__, __LINE__, "Question exceeds buffer size!...\n");
+        return false;
+    }
+    snprintf(quiz->question, QUESTION_SIZE, "%s", (const char*)question);
+
+    for (size_t i = 0; i < MAX_CHOICES; i++) {
+        const unsigned char *choice = sqlite3_column_text(stmt, 2 + i);
+        if (strlen((const char*)choice) >= BUF_SIZE) {
+            log_error(__func__, __FILE__, __LINE__, "Choice %zu exceeds buffer size.\n", i);
+            return false;
+        }
+        snprintf(quiz->choices[i], BUF_SIZE, "%s", (const char*)choice);
+    }
+
+    const int correct = sqlite3_column_int(stmt, 6);
+    if (correct < 0 || correct >= MAX_CHOICES) {
+        log_error(__func__, __FILE__, __LINE__, "Invalid correct choice %d!...\n", correct);
+        return false;
+    }
+    quiz->correct = (uint8_t)correct;
+    quiz->selected = MAX_CHOICES;
+    for (size_t i = 0; i < MAX_CHOICES; i++) {
+        quiz->order[i] = (uint8_t)i;
+    }
+    return true;
+}
+
+
+/**
+ * @brief This function prepares the statement selecting a question along with its choices by its id
+ *
+ * @param db A pointer to the SQLite3 database connection.
+ * @param tableName A pointer to the name of the quiz table.
+ *
+ * @returns A pointer to the statement (to be finalized), or NULL on error.
+ */
+static sqlite3_stmt *prepare_question(sqlite3 *db, const char *tableName) {
+    char sql[MAX_BUFF];
+    snprintf(sql, MAX_BUFF, "SELECT question_id, question, choice_a, choice_b, choice_c, choice_d, correct "
+                            "FROM %s WHERE question_id = ?;", tableName);
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v3(db, sql, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return NULL;
+    }
+    return stmt;
+}
+
+
+/**
+ * @returns true if a question is one of the questions already drawn in the game, otherwise false
+ */
+static bool drawn_question(const quiz_t *questions, const size_t drawn, const uint32_t id) {
+    for (size_t i = 0; i < drawn; i++) {
+        if ((uint32_t)questions[i].question_id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief This function reads a short range of the ids of a table, from an id up. The range wraps around
+ *        to the lowest id, so the probes from the highest ids read as many ids as the others.
+ *
+ * @param probe A pointer to the statement selecting the ids of the table from an id up
+ * @param start The id the range starts at
+ * @param low The lowest id of the table
+ * @param ids A pointer to the buffer receiving the ids, PROBE_ROWS at most
+ *
+ * @returns The number of ids read
+ */
+static size_t probe_ids(sqlite3_stmt *probe, const uint32_t start, const uint32_t low, uint32_t *ids) {
+    size_t count = 0;
+    for (int pass = 0; pass < 2 && count < PROBE_ROWS; pass++) {
+        sqlite3_reset(probe);
+        if (sqlite3_bind_int(probe, 1, (int)(pass == 0 ? start : low)) != SQLITE_OK ||
+            sqlite3_bind_int(probe, 2, (int)(PROBE_ROWS - count)) != SQLITE_OK) {
+            break;
+        }
+        while (count < PROBE_ROWS && sqlite3_step(probe) == SQLITE_ROW) {
+            const uint32_t id = (uint32_t)sqlite3_column_int(probe, 0);
+            if (pass == 1 && id >= start) {
+                break;
+            }
+            ids[count++] = id;
+        }
+        if (start == low) {
+            break;
+        }
+    }
+    return count;
+}
+
+
+/**
+ * @brief This function draws the questions left by probing short ranges of ids from random ids, the ones the
+ *        player hasn't seen first. It is only used when the ids are too sparse or too many of them are seen for
+ *        the sampler to find them, & reads PROBE_ROWS ids per probe whatever the size of the table.
+ *        If the probes only find seen questions, the bank is mostly seen & one of them comes back.
+ *
+ * @param db A pointer to the SQLite3 database connection.
+ * @param stmt A pointer to the statement selecting a question by its id
+ * @param tableName A pointer to the name of the quiz table.
+ * @param questions A pointer to the questions of the game.
+ * @param drawn The number of questions already drawn.
+ * @param maxQuests The number of questions to draw.
+ * @param low The lowest id of the table.
+ * @param range The number of ids between the lowest & the highest id of the table.
+ * @param rng A pointer to the generator.
+ * @param seen A pointer to the set of the questions to skip.
+ * @param task A pointer to the task to report the progress to, or NULL
+ *
+ * @returns true if the questions are drawn, otherwise false.
+ */
+static bool draw_from_probes(sqlite3 *db, sqlite3_stmt *stmt, const char *tableName, quiz_t *questions, size_t drawn,
+                             const size_t maxQuests, const uint32_t low, const uint32_t range, rng_t *rng,
+                             seen_t *seen, task_t *task) {
+    char sql[MAX_BUFF];
+    snprintf(sql, MAX_BUFF, "SELECT question_id FROM %s WHERE question_id >= ? ORDER BY question_id LIMIT ?;", tableName);
+
+    sqlite3_stmt *probe = NULL;
+    if (sqlite3_prepare_v3(db, sql, NULL_BYTE, NO_PREP_FLAG, &probe, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+        return false;
+    }
+
+    bool ret = true;
+    uint32_t ids[PROBE_ROWS];
+    while (ret && drawn < maxQuests) {
+        //? An unseen id of the probes is drawn, or else the first id that isn't in the game yet
+        uint32_t pick = 0, fallback = 0;
+        for (size_t tries = 0; pick == 0 && tries < PROBE_TRIES; tries++) {
+            const size_t count = probe_ids(probe, low + rng_below(rng, range), low, ids);
+            size_t unseen = 0;
+            for (size_t i = 0; i < count; i++) {
+                if (drawn_question(questions, drawn, ids[i])) {
+                    continue;
+                }
+                if (!seen_has(seen, ids[i])) {
+                    ids[unseen++] = ids[i];
+                } else if (fallback == 0) {
+                    fallback = ids[i];
+                }
+            }
+            if (unseen > 0) {
+                pick = ids[rng_below(rng, (uint32_t)unseen)];
+            }
+        }
+        pick = pick != 0 ? pick : fallback;
+        if (pick == 0) {
+            log_error(__func__, __FILE__, __LINE__, "Only %zu questions in %s!...\n", drawn, tableName);
+            ret = false;
+            break;
+        }
+
+        bool found = false;
+        ret = read_question(stmt, pick, &questions[drawn], &found) && found;
+        seen_mark(seen, pick);
+        drawn += 1;
+        task_progress(task, (uint32_t)(drawn * TASK_FINISHED / maxQuests));
+    }
+    sqlite3_finalize(probe);
+    return ret;
+}
+
+
+/**
+ * @brief This function reads random questions along with their choices, from the given table in the database.
+ *        The ids are drawn by the generator between the lowest & the highest id of the table, & drawn again
+ *        if the player has seen the question, so a question costs a couple of lookups of the primary key
+ *        whatever the size of the bank, & a seeded generator reads the same questions. The questions the
+ *        sampler misses (sparse ids, a mostly seen bank) are probed in short ranges, the table is never read whole.
  *
  * @param db A pointer to the SQLite3 database connection.
- * @param tableName A pointer to the name of the quiz table to read data from.
  * @param questions A pointer to the quiz_t structure to store the quiz data.
+ * @param tableName A pointer to the name of the quiz table to read data from.
  * @param maxQuests MAximum number fo questions to retrieve from the database
+ * @param rng A pointer to the generator sampling the questions
+ * @param seen A pointer to the set of the questions to skip, the questions drawn are marked in it
+ * @param task A pointer to the task to report the progress to, or NULL
  *
  * @returns true if quiz questions are successfully retrieved from the database, otherwise false.
  */
-bool get_questions(sqlite3 *db, quiz_t *questions, const char *tableName, const size_t maxQuests) {
-    if (NULL == db || NULL == questions || tableName == NULL || maxQuests <= 1) {
+bool get_questions(sqlite3 *db, quiz_t *questions, const char *tableName, const size_t maxQuests,
+                   rng_t *rng, seen_t *seen, task_t *task) {
+    if (NULL == db || NULL == questions || tableName == NULL || maxQuests < 1 || rng == NULL || seen == NULL) {
         log_error(__func__, __FILE__, __LINE__, "Invalid input parameters!...\n");
         return false;
     }
 
     char sql[MAX_BUFF];
-    snprintf(sql, MAX_BUFF, "SELECT * FROM %s ORDER BY RANDOM() LIMIT %zu;", tableName, maxQuests);
+    snprintf(sql, MAX_BUFF, "SELECT min(question_id), max(question_id) FROM %s;", tableName);
 
     sqlite3_stmt *stmt = NULL;
-    if (sqlite3_prepare_v3(db, sql, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK) {
-        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+    if (sqlite3_prepare_v3(db, sql, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK ||
+        sqlite3_step(stmt) != SQLITE_ROW || sqlite3_column_type(stmt, 0) == SQLITE_NULL) {
+        log_error(__func__, __FILE__, __LINE__, "No questions in %s : %s!...\n", tableName, sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
         return false;
     }
+    const uint32_t low = (uint32_t)sqlite3_column_int(stmt, 0);
+    const uint32_t range = (uint32_t)sqlite3_column_int(stmt, 1) - low + 1;
+    sqlite3_finalize(stmt);
 
-    int idx = 0;
-    while (sqlite3_step(stmt) == SQLITE_ROW && (size_t)idx < maxQuests) {
-        const unsigned char *question = sqlite3_column_text(stmt, 1);
-        if (strlen((const char*)question) >= MAX_BUFF) {
-            log_error(__func__, __FILE__, __LINE__, "Question exceeds buffer size!...\n");
-            sqlite3_finalize(stmt);
-            return false;
+    stmt = prepare_question(db, tableName);
+    if (stmt == NULL) {
+        return false;
+    }
+
+    //? The questions drawn are marked in the set, they are only looked for in the game if the set is full
+    bool ret = true, marked = true;
+    size_t drawn = 0;
+    for (size_t tries = 0; ret && drawn < maxQuests && tries < maxQuests * SAMPLE_TRIES; tries++) {
+        const uint32_t id = low + rng_below(rng, range);
+        bool found = false;
+        if (seen_has(seen, id) || (!marked && drawn_question(questions, drawn, id))) {
+            continue;
+        }
+        ret = read_question(stmt, id, &questions[drawn], &found);
+        if (ret && found) {
+            marked = seen_mark(seen, id) && marked;
+            drawn += 1;
+            task_progress(task, (uint32_t)(drawn * TASK_FINISHED / maxQuests));
+        }
+    }
+
+    if (ret && drawn < maxQuests) {
+        ret = draw_from_probes(db, stmt, tableName, questions, drawn, maxQuests, low, range, rng, seen, task);
+    }
+    sqlite3_finalize(stmt);
+    return ret;
+}
+
+
+// TODO : Arguments of the task fetching the questions of a game
+typedef struct FETCH_TASK {
+    quiz_t     *questions;
+    const char *category;
+    size_t      count;
+    rng_t       rng;        //? Forked from the generator of the session, the task never shares its state
+    char        playerId[ID_SIZE];  //? Empty for a guest, who has no seen questions
+    seen_t      seen;
+    bool        loaded;     //? The seen set is read, the next batches of the game keep it with the questions drawn
+} fetch_t;
+
+
+//? Phrases of a choice naming the others as a whole, ie: "None of the above", "All of these"
+static const char *const GROUP_PHRASES[] = {"of the above", "of these", "of the options"};
+//? Words joining the letters of the choices a choice names, ie: "A and B", "Both A", "Neither C nor D"
+static const char *const LETTER_JOINS[] = {"and", "or", "nor", "&"};
+static const char *const LETTER_LEADS[] = {"both", "either", "neither"};
+
+
+/**
+ * @returns true if the word of the given length is one of the given words, whatever their case
+ */
+static bool word_in(const char *word, const size_t len, const char *const *words, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (strlen(words[i]) == len && strncasecmp(word, words[i], len) == 0) {
+            return true;
         }
-        snprintf(questions[idx].question, MAX_BUFF, "%s", (const char*)question);
-
-        for (size_t i = 0; i < MAX_CHOICES; i++) {
-            const unsigned char *choice = sqlite3_column_text(stmt, 2 + i);
-            if (strlen((const char*)choice) >= BUF_SIZE) {
-                log_error(__func__, __FILE__, __LINE__, "Choice %zu exceeds buffer size.\n", i);
-                sqlite3_finalize(stmt);
-                return false;
+    }
+    return false;
+}
+
+
+/**
+ * @returns true if a choice names the other choices, by a phrase ("All of the above") or by their letters
+ *          joined to another letter ("A and B", "Both A"). A letter alone is part of the answer ("Vitamin A").
+ */
+static bool names_choices(const char *choice) {
+    for (size_t i = 0; i < sizeof(GROUP_PHRASES) / sizeof(GROUP_PHRASES[0]); i++) {
+        const size_t len = strlen(GROUP_PHRASES[i]);
+        for (const char *c = choice; *c != NULL_TERM; c++) {
+            if (strncasecmp(c, GROUP_PHRASES[i], len) == 0) {
+                return true;
             }
-            snprintf(questions[idx].choices[i], BUF_SIZE, "%s", (const char*)choice);
         }
+    }
 
-        const unsigned char *correct_answer = sqlite3_column_text(stmt, 6);
-        if (strlen((const char*)correct_answer) >= BUF_SIZE) {
-            log_error(__func__, __FILE__, __LINE__, "Correct choice exceeds buffer size!...\n");
-            sqlite3_finalize(stmt);
-            return false;
+    //? Set by a letter or a leading word, kept by the joining words, a letter that follows it names a choice
+    bool joined = false;
+    for (const char *word = choice + strspn(choice, " ,"); *word != NULL_TERM; word += strspn(word, " ,")) {
+        const size_t len = strcspn(word, " ,");
+        const bool letter = len == 1 && *word >= 'A' && *word <= 'D';
+        if (letter && joined) {
+            return true;
+        }
+        if (letter || word_in(word, len, LETTER_LEADS, sizeof(LETTER_LEADS) / sizeof(LETTER_LEADS[0]))) {
+            joined = true;
+        } else if (!word_in(word, len, LETTER_JOINS, sizeof(LETTER_JOINS) / sizeof(LETTER_JOINS[0]))) {
+            joined = false;
         }
-        snprintf(questions[idx].correct_choice, BUF_SIZE, "%s", (const char*)correct_answer);
+        word += len;
+    }
+    return false;
+}
+
 
-        idx += 1;
+/**
+ * @returns true if a choice of a question refers to the others by their position (ie: "All of the above",
+ *          "Both A and B"), the choices of such a question are always shown in the order they were saved
+ */
+static bool positional_choices(const quiz_t *quiz) {
+    for (size_t i = 0; i < MAX_CHOICES; ++i) {
+        if (names_choices(quiz->choices[i])) {
+            return true;
+        }
     }
-    sqlite3_finalize(stmt);
-    return true;
+    return false;
 }
 
 
 /**
- * @brief This function writes the randomly generated questions by the get_questions function,
- *        to the quiz_t structure and then displays the questions for the player to answer.
+ * @brief This function shuffles the order the choices of a question are shown in, for one game.
+ *        Only the indexes are shuffled, the choices stay where they were read.
  *
- * @param box_offset Offset position value of the box to be printed
- * @param player A pointer to the player stats structure.
- * @param category The category of questions to display.
+ * @param quiz A pointer to the question
+ * @param rng A pointer to the generator
  */
-void display_questions(const int box_offset, pstats_t *player, const char *category) {
+static void shuffle_choices(quiz_t *quiz, rng_t *rng) {
+    if (positional_choices(quiz)) {
+        return;
+    }
+    for (size_t i = MAX_CHOICES - 1; i > 0; i--) {
+        const size_t j = rng_below(rng, (uint32_t)i + 1);
+        const uint8_t choice = quiz->order[i];
+        quiz->order[i] = quiz->order[j];
+        quiz->order[j] = choice;
+    }
+}
+
+
+/**
+ * @brief This function reads the questions of a game (or of its next batch) from the database & shuffles
+ *        their choices, it runs on the thread of a task
+ *
+ * @param task A pointer to the task
+ * @param context A pointer to the 'fetch_t' arguments
+ *
+ * @returns true if the questions are read, otherwise false
+ */
+static bool fetch_questions_task(task_t *task, void *context) {
+    fetch_t *fetch = context;
+
     sqlite3 *db = NULL;
-    if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
+    if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
         log_error(__func__, __FILE__, __LINE__, "Error opening database : errMsg = %s!...\n", sqlite3_errmsg(db));
-        cgetch();
-        mainmenu(box_offset, player);
+        sqlite3_close(db);
+        return false;
     }
 
-    char content[BUF_SIZE];
-    sprintf(content, " QUIZBIT - %s TEST ", category);
-    quiz_t questions[MAX_QUESTIONS + 1];
+    //? The questions the player has seen lately are skipped, a failure to read them only lets them come back
+    if (!fetch->loaded) {
+        seen_clear(&fetch->seen);
+        if (fetch->playerId[0] != NULL_TERM &&
+            !retrieve_seen_questions(db, fetch->playerId, fetch->category, &fetch->seen)) {
+            log_error(__func__, __FILE__, __LINE__, "Failed to read the seen questions : %s!...\n", sqlite3_errmsg(db));
+        }
+        fetch->loaded = true;
+    }
 
-    //? Read '10' random questions from the given table
-    if (get_questions(db, questions, category, MAX_QUESTIONS) == false) {
+    const bool ret = get_questions(db, fetch->questions, fetch->category, fetch->count, &fetch->rng, &fetch->seen, task);
+    if (!ret) {
         log_error(__func__, __FILE__, __LINE__, "Failed to get questions from db %s!...\n", sqlite3_errmsg(db));
-        sqlite3_close(db);
-        cgetch();
-        mainmenu(box_offset, player);
     }
     sqlite3_close(db);
 
+    for (size_t i = 0; ret && i < fetch->count; i++) {
+        shuffle_choices(&fetch->questions[i], &fetch->rng);
+    }
+    return ret;
+}
+
+
+// TODO : Struct for holding the questions of the next game, read in the background while the player
+//        looks at the results of the last one, so the next game of the same category starts at once
+typedef struct PREFETCH {
+    quiz_t   questions[MAX_QUESTIONS + 1];
+    fetch_t  fetch;
+    task_t   task;
+    bool     pending;   //? The task is reading or has read questions not taken yet
+    uint32_t used;
+    uint32_t wasted;    //? Read but never shown, a game of another category was started or the player left
+} prefetch_t;
+
+static prefetch_t prefetch;
+
+
+/**
+ * @brief This function drops the questions read in the background, after waiting for their task to complete
+ *        The drop is counted & logged with the totals, to tune what is prefetched.
+ */
+void prefetch_discard(void) {
+    if (!prefetch.pending) {
+        return;
+    }
+    task_wait(&prefetch.task);
+    prefetch.pending = false;
+    prefetch.wasted += 1;
+    log_write(LEVEL_INFO, __func__, __FILE__, __LINE__, "Prefetched %s questions wasted (%u wasted, %u used)\n",
+              prefetch.fetch.category, prefetch.wasted, prefetch.used);
+}
+
+
+/**
+ * @brief This function starts reading the questions of the next game in the background
+ *
+ * @param session A pointer to the state of the game session, its category must outlive the task (ie: a literal)
+ *                & the task gets a generator forked from the one of the session
+ */
+static void prefetch_start(session_t *session) {
+    prefetch_discard();
+
+    fetch_t *fetch = &prefetch.fetch;
+    fetch->questions = prefetch.questions;
+    fetch->category = session->category;
+    fetch->count = MAX_QUESTIONS;
+    fetch->loaded = false;
+    snprintf(fetch->playerId, ID_SIZE, "%s", session->player.profile.playerId);
+    rng_fork(&session->rng, &fetch->rng);
+    task_start(&prefetch.task, fetch_questions_task, &prefetch.fetch);
+    prefetch.pending = true;
+}
+
+
+/**
+ * @brief This function takes the questions read in the background, if they are of the category of the game
+ *        & were read for the same player. The state of their fetch is taken too, so the next batches of
+ *        a marathon go on with the same generator & seen set.
+ *
+ * @param session A pointer to the state of the game session, holding the player & the category of the game
+ * @param fetch A pointer to the fetch of the game, MAX_QUESTIONS are copied to its questions
+ *
+ * @returns true if the questions are taken, otherwise false & they have to be read now
+ */
+static bool prefetch_take(const session_t *session, fetch_t *fetch) {
+    if (!prefetch.pending || strcmp(prefetch.fetch.category, session->category) != 0 ||
+        strcmp(prefetch.fetch.playerId, session->player.profile.playerId) != 0) {
+        prefetch_discard();
+        return false;
+    }
+
+    const bool ret = task_wait(&prefetch.task);
+    prefetch.pending = false;
+    if (!ret) {
+        return false;
+    }
+    quiz_t *questions = fetch->questions;
+    memcpy(fetch, &prefetch.fetch, sizeof(fetch_t));
+    fetch->questions = questions;
+    memcpy(questions, prefetch.questions, fetch->count * sizeof(quiz_t));
+    prefetch.used += 1;
+    return true;
+}
+
+
+// TODO : Struct for holding the questions of a game, streamed from the sampler MAX_QUESTIONS at a time.
+//        The next batch is read in the background while the current one is answered, so a game of any
+//        length only holds two batches of questions, its answers are kept without their text.
+typedef struct STREAM {
+    quiz_t   batch[MAX_QUESTIONS];
+    quiz_t   next[MAX_QUESTIONS];   //? Read by the task
+    size_t   count;                 //? Questions of the current batch
+    size_t   shown;                 //? Questions of the current batch already shown
+    size_t   left;                  //? Questions of the game not read yet
+    fetch_t  fetch;                 //? Keeps the generator & the seen set of the game from a batch to the next
+    task_t   task;
+    bool     pending;               //? The task is reading the next batch
+    bool     failed;                //? A batch couldn't be read, the game ended before its last question
+} stream_t;
+
+
+/**
+ * @brief This function starts reading the next batch of questions of a game in the background, if any are left
+ *
+ * @param stream A pointer to the questions of the game
+ */
+static void stream_read(stream_t *stream) {
+    if (stream->left == 0) {
+        return;
+    }
+    stream->fetch.questions = stream->next;
+    stream->fetch.count = stream->left < MAX_QUESTIONS ? stream->left : MAX_QUESTIONS;
+    task_start(&stream->task, fetch_questions_task, &stream->fetch);
+    stream->pending = true;
+}
+
+
+/**
+ * @brief This function makes the batch read the current one, & starts reading the one after it
+ *
+ * @param stream A pointer to the questions of the game, its task must be completed
+ */
+static void stream_take(stream_t *stream) {
+    memcpy(stream->batch, stream->next, stream->fetch.count * sizeof(quiz_t));
+    stream->count = stream->fetch.count;
+    stream->shown = 0;
+    stream->left -= stream->count;
+    stream_read(stream);
+}
+
+
+/**
+ * @brief This function gives the next question of a game. The loader is only drawn if the player
+ *        answered the current batch before the next one was read.
+ *
+ * @param stream A pointer to the questions of the game
+ * @param x X-coordinate of the loader
+ * @param y Y-coordinate of the loader
+ *
+ * @returns A pointer to the question, or NULL if the game has no questions left or they can't be read
+ */
+static quiz_t *stream_next(stream_t *stream, const int x, const int y) {
+    if (stream->shown == stream->count) {
+        if (!stream->pending) {
+            return NULL;
+        }
+        stream->pending = false;
+        const bool ret = task_done(&stream->task) ?
+            task_wait(&stream->task) : display_loader(x, y, "Loading the next questions!...", &stream->task);
+        if (!ret) {
+            log_error(__func__, __FILE__, __LINE__, "Failed to read the next %s questions!...\n", stream->fetch.category);
+            stream->failed = true;
+            return NULL;
+        }
+        stream_take(stream);
+    }
+    return &stream->batch[stream->shown++];
+}
+
+
+/**
+ * @brief This function waits for the batch being read, if any, then frees the questions of a game
+ *
+ * @param stream A pointer to the questions of the game
+ */
+static void stream_free(stream_t *stream) {
+    if (stream->pending) {
+        task_wait(&stream->task);
+    }
+    free(stream);
+}
+
+
+/**
+ * @returns What is kept of a question once it is answered, its text is read back to be reviewed
+ */
+static answer_t answer_of(const quiz_t *quiz) {
+    answer_t answer = {
+        .question_id = quiz->question_id, .outcome = quiz->outcome, .latency_ms = quiz->latency_ms,
+        .correct = quiz->correct, .selected = quiz->selected
+    };
+    memcpy(answer.order, quiz->order, sizeof(answer.order));
+    return answer;
+}
+
+
+// TODO : Steps of the task saving the results of a game, the failed step is reported to the screen
+typedef enum SAVE_STEPS {
+    SAVE_SCORE,
+    SAVE_GAMESTATS,
+    SAVE_RESULT,
+    SAVE_RELOAD,
+    SAVE_DONE
+} ssteps_t;
+
+// TODO : Arguments of the task saving the results of a game
+typedef struct SAVE_TASK {
+    pstats_t        *player;
+    const gresult_t *result;
+    ssteps_t         step;   //? The step that failed, or SAVE_DONE
+} save_t;
+
+
+/**
+ * @brief This function saves the new score & game stats of the player, & the result of the game with the time
+ *        taken on each question, then reloads the player record. It runs on the thread of a task.
+ *
+ * @param task A pointer to the task
+ * @param context A pointer to the 'save_t' arguments
+ *
+ * @returns true if every step succeeded, otherwise false
+ */
+static bool save_results_task(task_t *task, void *context) {
+    save_t *save = context;
+    pstats_t *player = save->player;
+
+    save->step = SAVE_SCORE;
+    if (!update_score(player, player->scores.currentScore, player->scores.averageScore, player->scores.highestScore)) {
+        return false;
+    }
+    task_progress(task, TASK_FINISHED / 4);
+
+    save->step = SAVE_GAMESTATS;
+    if (!update_gamestats(player)) {
+        return false;
+    }
+    task_progress(task, TASK_FINISHED * 2 / 4);
+
+    save->step = SAVE_RESULT;
+    if (!insert_game_result(player, save->result)) {
+        return false;
+    }
+    task_progress(task, TASK_FINISHED * 3 / 4);
+
+    save->step = SAVE_RELOAD;
+    if (!get_player_data(player->profile.username, player)) {
+        return false;
+    }
+    save->step = SAVE_DONE;
+    return true;
+}
+
+
+//? Columns of the text of a question, between the prompt paddings of the box
+#define QUESTION_WIDTH ((size_t)(MIN_BOX_WIDTH - 2 * PROMPT_PADDING))
+
+
+/**
+ * @brief This function gives the lines of a question wrapped after its number. They come from the cache,
+ *        so the answers page reuses the lines wrapped during the game.
+ *
+ * @param quiz A pointer to the question
+ * @param number The number of the question in the game
+ * @param label A pointer to the buffer receiving the number label, BADGE_SIZE bytes
+ *
+ * @returns A pointer to the wrapped lines
+ */
+static const wrapped_t *wrap_question(const quiz_t *quiz, const int number, char *label) {
+    snprintf(label, BADGE_SIZE, "%i.) ", number);
+    return wrap_cached(quiz->question_id, quiz->question, QUESTION_WIDTH - width_str(label));
+}
+
+
+/**
+ * @brief This function gives the lines of an answer of the answers page, wrapped after its label
+ *
+ * @param quiz A pointer to the question the answer belongs to
+ * @param label A pointer to the label printed before the answer
+ * @param answer A pointer to the text of the answer
+ *
+ * @returns A pointer to the wrapped lines
+ */
+static const wrapped_t *wrap_answer(const quiz_t *quiz, const char *label, const char *answer) {
+    //? The choices share the id of their question, their texts tell them apart in the cache
+    return wrap_cached(-quiz->question_id, answer, QUESTION_WIDTH - 2 - width_str(label));
+}
+
+
+/**
+ * @brief This function prints the number of a question & its text wrapped to the box
+ *
+ * @param x X-coordinate of the question
+ * @param y Y-coordinate of the question
+ * @param quiz A pointer to the question
+ * @param number The number of the question in the game
+ * @param max_lines The number of rows available
+ *
+ * @returns The number of rows printed
+ */
+static size_t print_question(const int x, const int y, const quiz_t *quiz, const int number, const size_t max_lines) {
+    char label[BADGE_SIZE];
+    const wrapped_t *lines = wrap_question(quiz, number, label);
+    mvprint(x, y, BOLD, "%s", label);
+    return wrap_print(x + (int)width_str(label), y, BOLD, quiz->question, lines, max_lines);
+}
+
+
+/**
+ * @brief This function draws a question & its choices wrapped to the box, within QUESTION_ROWS rows.
+ *        Every choice keeps at least one row, the question takes the rows they leave.
+ *
+ * @param x X-coordinate of the question
+ * @param y Y-coordinate of the question
+ * @param quiz A pointer to the question
+ * @param number The number of the question in the game
+ */
+static void draw_question(const int x, const int y, const quiz_t *quiz, const int number) {
+    size_t used = print_question(x, y, quiz, number, QUESTION_ROWS - MAX_CHOICES);
+
+    for (size_t i = 0; i < MAX_CHOICES; ++i) {
+        char label[BADGE_SIZE];
+        snprintf(label, sizeof(label), "[%c]. ", 'A' + (int)i);
+        const char *choice = quiz->choices[quiz->order[i]];
+
+        const wrapped_t *lines = wrap_cached(-quiz->question_id, choice, QUESTION_WIDTH - 3 - width_str(label));
+        const size_t rows = QUESTION_ROWS - used - (MAX_CHOICES - i - 1);
+        mvprint(x + 3, y + (int)used, BOLD, "%s", label);
+        used += wrap_print(x + 3 + (int)width_str(label), y + (int)used, BOLD, choice, lines, rows);
+    }
+}
+
+
+/**
+ * @returns The letter a choice was shown with in the game
+ */
+static char choice_letter(const quiz_t *quiz, const uint8_t choice) {
+    for (size_t i = 0; i < MAX_CHOICES; ++i) {
+        if (quiz->order[i] == choice) {
+            return (char)('A' + i);
+        }
+    }
+    return '?';
+}
+
+
+/**
+ * @brief This function prints an answer of the answers page, wrapped after its label
+ *
+ * @param x X-coordinate of the answer
+ * @param y Y-coordinate of the answer
+ * @param quiz A pointer to the question the answer belongs to
+ * @param label A pointer to the label printed before the answer
+ * @param answer A pointer to the text of the answer
+ *
+ * @returns The number of rows printed
+ */
+static size_t print_answer(const int x, const int y, const quiz_t *quiz, const char *label, const char *answer) {
+    mvprint(x, y, BOLD, "%s", label);
+    return wrap_print(x + (int)width_str(label), y, BOLD, answer, wrap_answer(quiz, label, answer), REVIEW_ROWS - 1);
+}
+
+
+/**
+ * @brief This function streams the questions of a game from the sampler & displays them for the player to answer.
+ *        A game has MAX_QUESTIONS questions, a marathon up to MAX_MARATHON until the player ends it, only
+ *        the answers are kept once shown. The questions of the next game are then read in the background,
+ *        while the results are viewed.
+ *
+ * @param session A pointer to the state of the game session, holding the player & the category of questions
+ *
+ * @returns The transition back to the main menu, to the categories if the results can't be saved,
+ *          or to the homepage if the player data can't be read back
+ */
+transition_t display_questions(session_t *session) {
+    const int box_offset = session->box_offset;
+    const char *category = session->category;
+    const bool marathon = session->marathon;
+    pstats_t *player = &session->player;
+
     const int x_coord = box_offset, y_coord = 1;
     char heading[BUF_SIZE] = " QUIZBIT ━━ GAMEPLAY ";
 
-    draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
-    display_header(box_offset, heading, player);
-    display_footer(box_offset);
-
     const int tmp_x = x_coord + PROMPT_PADDING;
     const int tmp_y = y_coord + HEADER_HEIGHT + 3;
 
-    display_progress_bar(x_coord, tmp_y + 1, "Gameplay loading please wait");
+    const size_t length = marathon ? MAX_MARATHON : MAX_QUESTIONS;
+    stream_t *stream = malloc(sizeof(stream_t));
+    answer_t *answers = malloc(length * sizeof(answer_t));
+    if (stream == NULL || answers == NULL) {
+        log_error(__func__, __FILE__, __LINE__, "malloc() : %s\n", strerror(ENOMEM));
+        free(stream);
+        free(answers);
+        return scene_back();
+    }
+    stream->pending = false;
+    stream->failed = false;
+    stream->left = length;
+    stream->fetch.questions = stream->next;
 
-    short qid = 0, skipped = 0;
-    uint32_t score = 0;
+    //? The questions read in the background after the last game are shown at once,
+    //? otherwise the first '10' random questions are read from the given table, while the loading screen is drawn
+    if (!prefetch_take(session, &stream->fetch)) {
+        stream->fetch = (fetch_t){.category = category, .loaded = false};
+        snprintf(stream->fetch.playerId, ID_SIZE, "%s", player->profile.playerId);
+        rng_fork(&session->rng, &stream->fetch.rng);
+        stream_read(stream);
+        stream->pending = false;
 
-    const clock_t start_time = clock();
-    do {
-        memset(heading, 0, sizeof(heading));
-        snprintf(heading, BUF_SIZE, " QUIZBIT ━━ %s TEST ", category);
+        draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
+        display_header(box_offset, heading, player);
+        display_footer(box_offset);
 
+        if (!display_progress_bar(x_coord, tmp_y + 1, "Gameplay loading please wait", &stream->task)) {
+            print_error(tmp_x, tmp_y + 5, "Failed to load the questions!...");
+            cgetch();
+            free(stream);
+            free(answers);
+            return scene_back();
+        }
+    }
+    //? The batches after the first are read while the player answers the one before
+    stream_take(stream);
+
+    snprintf(heading, BUF_SIZE, " QUIZBIT ━━ %s %s ", category, marathon ? "MARATHON" : "TEST");
+    const char *prompt = marathon ?
+        " PRESS [S] TO SKIP THE QUESTION, [Q] TO END THE MARATHON" : " PRESS [S] TO SKIP THE QUESTION";
+
+    size_t count = 0;
+    uint32_t score = 0, skipped = 0;
+
+    gtiming_t timing;
+    timing_start(&timing);
+    for (quiz_t *quiz = stream_next(stream, tmp_x, tmp_y + 11); quiz != NULL; quiz = stream_next(stream, tmp_x, tmp_y + 11)) {
         draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
         display_header(box_offset, heading, player);
         display_footer(box_offset);
 
-        questions[qid].question_id = (int)qid + 1;
-        mvprint(tmp_x, tmp_y + 1, BOLD, "%i.) %s", questions[qid].question_id, questions[qid].question);
+        draw_question(tmp_x, tmp_y + 1, quiz, (int)count + 1);
+        mvprint(tmp_x, tmp_y + 9, BOLD, "%s", prompt);
 
-        for (size_t i = 0; i < MAX_CHOICES; ++i) {
-            mvprint(tmp_x + 3, tmp_y + i + 2, BOLD, "%s", questions[qid].choices[i]);
+        timing_shown(&timing);
+        const uint32_t check = check_answer(quiz, marathon);
+        if (check == QUIT) {
+            break;
         }
-        mvprint(tmp_x, tmp_y + 9, BOLD, " PRESS [S] TO SKIP THE QUESTION");
-
-        const uint32_t check = check_answer(questions, qid);
+        quiz->latency_ms = timing_answered(&timing);
         if (check == SKIP) {
             skipped += 1;
         } else {
             score += check;
         }
+        answers[count++] = answer_of(quiz);
+    }
+    timing_stop(&timing);
+    const bool failed = stream->failed;
+    stream_free(stream);
 
-        qid += 1;
-    } while (qid < MAX_QUESTIONS);
-    const clock_t end_time = clock();
-
-    const double elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+    //? A marathon ended on its first question has nothing to save, nor has a game cut short by its questions.
+    //? A marathon cut short is saved with the questions answered, as if the player had ended it.
+    if (count == 0 || (failed && !marathon)) {
+        if (failed) {
+            print_error(tmp_x, tmp_y + 11, "Failed to load the next questions, the %s isn't saved!...",
+                        marathon ? "marathon" : "game");
+        } else {
+            print_error(tmp_x, tmp_y + 11, "No question answered, the %s isn't saved!...", marathon ? "marathon" : "game");
+        }
+        mvprint(tmp_x, tmp_y + 13, BOLD, "%s Press any key to go back to the main menu : ", BACK_EMOJI);
+        cgetch();
+        free(answers);
+        return scene_back();
+    }
+    if (failed) {
+        print_error(tmp_x, tmp_y + 17, "Failed to load the next questions, the marathon ends here!...");
+    }
 
-    print_success(tmp_x, tmp_y + 11, "You scored : %04u points", score);
-    const uint32_t bonusScore = assign_bonus(score, elapsed_time);
+    if (marathon) {
+        print_success(tmp_x, tmp_y + 11, "You scored : %04u points over %zu questions", score, count);
+    } else {
+        print_success(tmp_x, tmp_y + 11, "You scored : %04u points", score);
+    }
+    const uint32_t bonusScore = assign_bonus(score, (uint32_t)count, &timing);
     print_success(tmp_x, tmp_y + 13, "Your new score after the bonus is %04u", score + bonusScore);
-    getnew_playerstats(player, player->scores.currentScore, bonusScore, score, skipped, elapsed_time);
+    getnew_playerstats(player, player->scores.currentScore, bonusScore, score, skipped, (uint32_t)count, &timing);
 
     player->scores.currentScore = score + bonusScore;
 
-    unlock_achievements(player, player->scores.currentScore, elapsed_time);
+    unlock_achievements(player, player->scores.currentScore, (uint32_t)count, &timing);
 
-    if (!update_score(player, player->scores.currentScore, player->scores.averageScore, player->scores.highestScore)) {
-        print_error(tmp_x, tmp_y + 15, "Failed to update new score!...");
+    const gresult_t result = {
+        .category = category, .answers = answers, .count = count,
+        .score = score, .bonus = bonusScore, .skipped = skipped, .timing = &timing
+    };
+    task_t task;
+    save_t save = {.player = player, .result = &result, .step = SAVE_SCORE};
+    task_start(&task, save_results_task, &save);
+    if (!display_loader(tmp_x, tmp_y + 15, "Saving your results!...", &task)) {
+        free(answers);
+        switch (save.step) {
+            case SAVE_SCORE :
+                print_error(tmp_x, tmp_y + 15, "Failed to update new score!...");
                 delay(2000);
-        gameplay(box_offset, player);
-    }
-    if (!update_gamestats(player)) {
-        print_error(tmp_x, tmp_y + 15, "Failed to update player stats!...");
-            delay(2000);
-        gameplay(box_offset, player);
-    }
-    if (!get_player_data(player->profile.username, player)) {
-        print_error(tmp_x, tmp_y + 15, "Failed to get updated data, please login again!...");
-        delay(2000);
-        logout(box_offset, player);
+                return scene_replace(SCENE_GAMEPLAY);
+
+            case SAVE_GAMESTATS :
+                print_error(tmp_x, tmp_y + 15, "Failed to update player stats!...");
+                delay(2000);
+                return scene_replace(SCENE_GAMEPLAY);
+
+            case SAVE_RESULT :
+                print_error(tmp_x, tmp_y + 15, "Failed to save the game result!...");
+                delay(2000);
+                return scene_replace(SCENE_GAMEPLAY);
+
+            default :
+                print_error(tmp_x, tmp_y + 15, "Failed to get updated data, please login again!...");
+                delay(2000);
+                return logout(session);
+        }
     }
 
+    //? The player is likely to play the same category again, its next questions are read while the results are viewed
+    prefetch_start(session);
+
     mvprint(tmp_x, tmp_y + 15, BOLD, " %s Do you want to view your answers [Y/N] ? ", EYES_EMOJI);
     if (get_confirmation(NULL) == 'Y') {
-        display_answered(box_offset, player, questions);
+        display_answered(box_offset, player, &result);
     }
+    free(answers);
 
     mvprint(tmp_x, tmp_y + 20, BOLD, "%s Press any key to go back to the main menu : ", BACK_EMOJI);
     cgetch();
-    mainmenu(box_offset, player);
+    return scene_back();
 }
 
 
 /**
- * @brief This function keeps records of the answers the user entered while playing and displays them after the game.
+ * @brief This function displays the answers the player entered during a game.
+ *        The answers are paged by the rows their wrapped lines take, the text of a question is read back
+ *        from the database when its page is drawn, so the answers of a long game are paged lazily.
  *
  * @param box_offset Offset position value of the box to be printed
  * @param player A pointer to the player stats structure.
- * @param quest A pointer to the Quiz_t structure containing questions and correct answers.
+ * @param result A pointer to the result of the game, holding its category & answers.
 **/
-void display_answered(const int box_offset, pstats_t *player, quiz_t *quest) {
-    short qid = 0, check = 0;
-    for (int i = 0; i < 2; ++i) {
-        const int x_coord = box_offset, y_coord = 1;
-        const char *heading = " QUIZBIT ━━ TEST ANSWERS ";
+void display_answered(const int box_offset, pstats_t *player, const gresult_t *result) {
+    sqlite3 *db = NULL;
+    if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Error opening database : errMsg = %s!...\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return;
+    }
+    sqlite3_stmt *stmt = prepare_question(db, result->category);
+    if (stmt == NULL) {
+        sqlite3_close(db);
+        return;
+    }
 
-        draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
-        display_header(box_offset, heading, player);
-        display_footer(box_offset);
+    const int x_coord = box_offset, y_coord = 1;
+    const char *heading = " QUIZBIT ━━ TEST ANSWERS ";
+    const int tmp_x = x_coord + PROMPT_PADDING;
+    const int first_y = y_coord + HEADER_HEIGHT + 3;
+    const int prompt_y = y_coord + MIN_BOX_HEIGHT - 5;   //? Row of the prompt, the answers end two rows above
+    const char *prompt = " Press the [SPACE-BAR] key to view the rest, [Q] to stop : ";
 
-        const int tmp_x = x_coord + PROMPT_PADDING; int tmp_y = y_coord + HEADER_HEIGHT + 1;
+    char your_label[BUF_SIZE], correct_label[BUF_SIZE];
+    quiz_t question;
+    const quiz_t *quiz = &question;
 
-        while (check < MAX_QUESTIONS) {
-            quest[qid].question_id = (int)qid + 1;
-            mvprint(tmp_x, tmp_y += 2, BOLD, "%hi.) %s", quest[qid].question_id, quest[qid].question);
+    int tmp_y = prompt_y;
+    for (size_t qid = 0; qid < result->count; ++qid) {
+        const answer_t *answer = &result->answers[qid];
+        bool found = false;
+        if (!read_question(stmt, (uint32_t)answer->question_id, &question, &found) || !found) {
+            log_error(__func__, __FILE__, __LINE__, "Failed to read question %d back!...\n", answer->question_id);
+            break;
+        }
+        question.correct = answer->correct;
+        question.selected = answer->selected;
+        memcpy(question.order, answer->order, sizeof(question.order));
 
-            if (strcmp(quest[qid].selected_choice, quest[qid].correct_choice) == 0) {
-                mvprint(tmp_x + 2, tmp_y += 1, BOLD, "%s Your Answer    : %s", CHECKM_EMOJI, quest[qid].selected_choice);
-                mvprint(tmp_x + 2, tmp_y += 1, BOLD, "%s Correct Answer : %s", CHECKM_EMOJI, quest[qid].correct_choice);
-            }
-            else {
-                mvprint(tmp_x + 2, tmp_y += 1, BOLD, "%s Your Answer    : %s", CROSSM_EMOJI, quest[qid].selected_choice);
-                mvprint(tmp_x + 2, tmp_y += 1, BOLD, "%s Correct Answer : %s", CHECKM_EMOJI, quest[qid].correct_choice);
-            }
-            qid += 1;
-            check += 1;
-            if (MAX_QUESTIONS / 2 == check) {
-                break;
-            }
+        const bool correct = quiz->selected == quiz->correct;
+        const bool skipped = quiz->selected >= MAX_CHOICES;
+        const char *your_answer = skipped ? "SKIPPED" : quiz->choices[quiz->selected];
+        const char *correct_answer = quiz->choices[quiz->correct];
+
+        //? The letters are the ones the choices were shown with in this game
+        if (skipped) {
+            snprintf(your_label, sizeof(your_label), "%s Your Answer    : ", CROSSM_EMOJI);
+        } else {
+            snprintf(your_label, sizeof(your_label), "%s Your Answer    : [%c]. ",
+                     correct ? CHECKM_EMOJI : CROSSM_EMOJI, choice_letter(quiz, quiz->selected));
         }
-        if (check > MAX_QUESTIONS - 1) {
-            break;
+        snprintf(correct_label, sizeof(correct_label), "%s Correct Answer : [%c]. ",
+                 CHECKM_EMOJI, choice_letter(quiz, quiz->correct));
+
+        //? Rows of this answer block, from the cached lines
+        char label[BADGE_SIZE];
+        const size_t lines[] = {
+            wrap_question(quiz, (int)qid + 1, label)->count,
+            wrap_answer(quiz, your_label, your_answer)->count,
+            wrap_answer(quiz, correct_label, correct_answer)->count
+        };
+        int rows = 0;
+        for (size_t i = 0; i < 3; i++) {
+            const size_t max_lines = i == 0 ? REVIEW_ROWS : REVIEW_ROWS - 1;
+            rows += (int)(lines[i] < max_lines ? lines[i] : max_lines);
+        }
+
+        if (tmp_y + rows > prompt_y - 2) {
+            if (qid > 0) {
+                mvprint(tmp_x, prompt_y, BOLD, "%s", prompt);
+                int key;
+                do {
+                    key = toupper(cgetch());
+                } while (key != SPACE_BAR && key != 'Q');
+                if (key == 'Q') {
+                    mvprint(tmp_x, prompt_y, BOLD, "%*s", (int)width_str(prompt), "");
+                    break;
+                }
+            }
+            draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
+            display_header(box_offset, heading, player);
+            display_footer(box_offset);
+            tmp_y = first_y;
         }
-        mvprint(tmp_x, tmp_y + 2, BOLD, " Press the [SPACE-BAR] key to view the rest : ");
-        do { } while (cgetch() != SPACE_BAR);
+
+        tmp_y += (int)print_question(tmp_x, tmp_y, quiz, (int)qid + 1, REVIEW_ROWS);
+        tmp_y += (int)print_answer(tmp_x + 2, tmp_y, quiz, your_label, your_answer);
+        tmp_y += (int)print_answer(tmp_x + 2, tmp_y, quiz, correct_label, correct_answer);
+        tmp_y += 1;
     }
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
 }
 
 
 
 /**
  * @brief This function compares the selected choice to the correct choice and return the score of that question.
+ *        The letter typed is mapped to its choice through the order of the game, then the indexes are compared.
+ *        The outcome of the question is kept with it.
  *
- * @param questions A pointer to the quiz questions and answers structure
- * @param qid A variable to hold the current question id
- * @returns 100 if the selected choice is correct, else return 0
+ * @param quiz A pointer to the question shown
+ * @param marathon true if the player may end the game with [Q], ie: in a marathon
+ * @returns 100 if the selected choice is correct, SKIP if the question is skipped, QUIT if the game is ended,
+ *          else return 0
  */
-uint32_t check_answer(quiz_t *questions, const short qid) {
+uint32_t check_answer(quiz_t *quiz, const bool marathon) {
     short check;
     do {
         const int choice = toupper(cgetch());
@@ -235,37 +1060,42 @@ uint32_t check_answer(quiz_t *questions, const short qid) {
             case 'B' :
             case 'C' :
             case 'D' :
-                snprintf(questions[qid].selected_choice, BUF_SIZE, "%s", questions[qid].choices[choice - 'A']);
+                quiz->selected = quiz->order[choice - 'A'];
             check = VALUE_SUCCESS;
             break;
             case 'S' :
-                snprintf(questions[qid].selected_choice, BUF_SIZE, "SKIPPED");
+                quiz->selected = MAX_CHOICES;
+                quiz->outcome = ANSWER_SKIPPED;
                 return SKIP;
+            case 'Q' :
+                if (marathon) {
+                    return QUIT;
+                }
+                check = VALUE_ERROR;
+                break;
             default:
                 check = VALUE_ERROR;
         }
     } while (VALUE_ERROR == check);
 
-    return strcmp(questions[qid].selected_choice, questions[qid].correct_choice) == VALUE_SUCCESS ? MAXIMUM_SCORE : INITIAL_SCORE;
+    const bool correct = quiz->selected == quiz->correct;
+    quiz->outcome = correct ? ANSWER_CORRECT : ANSWER_INCORRECT;
+    return correct ? MAXIMUM_SCORE : INITIAL_SCORE;
 }
 
 
 /**
  * @brief This function is only called when user wants to play as guest
  *        It displays 5 random question from a random game category
+ *
+ * @param session A pointer to the state of the game session
+ *
+ * @returns The transition back to the homepage
  */
-void play_as_guest(const int BOX_OFFSET) {
-    sqlite3 *db = NULL;
-    if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
-        log_error(__func__, __FILE__, __LINE__, "Failed To Open Database : %s!...\n", sqlite3_errmsg(db));
-        cgetch();
-        homepage(BOX_OFFSET);
-    }
-
+transition_t play_as_guest(session_t *session) {
+    const int box_offset = session->box_offset;
     const char *categorySet[] = {"SPORTS", "SCIENCE", "BASICS"};
-    srand(time(NULL));
-    const int randomIndex = rand() % 3;
-    const char *category = categorySet[randomIndex];
+    const char *category = categorySet[rng_below(&session->rng, 3)];
 
     char content[BUF_SIZE];
     sprintf(content, " QUIZBIT - %s TEST ", category);
@@ -273,30 +1103,31 @@ void play_as_guest(const int BOX_OFFSET) {
     const size_t maxQuestions = MAX_QUESTIONS / 2;
     quiz_t questions[maxQuestions + 1];
 
-    //? Read 5 random questions from the given table
-    if (!get_questions(db, questions, category, maxQuestions)) {
-        log_error(__func__, __FILE__, __LINE__, "Failed to get questions from db!...\n");
-        sqlite3_close(db);
-        cgetch();
-        homepage(BOX_OFFSET);
-    }
-    sqlite3_close(db);
+    //? Read 5 random questions from the given table, while the loading screen is drawn, a guest has no seen questions
+    fetch_t fetch = {.questions = questions, .category = category, .count = maxQuestions};
+    rng_fork(&session->rng, &fetch.rng);
+    task_t task;
+    task_start(&task, fetch_questions_task, &fetch);
 
     char guestId[ID_SIZE];
     assign_new_player_id(guestId);
 
-    const int x_coord = BOX_OFFSET, y_coord = 1;
+    const int x_coord = box_offset, y_coord = 1;
     char heading[BUF_SIZE] = " QUIZBIT ━━ GUESTMODE ";
 
     draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
-    display_header(BOX_OFFSET, heading, NULL);
-    display_footer(BOX_OFFSET);
+    display_header(box_offset, heading, NULL);
+    display_footer(box_offset);
 
     const int tmp_x = x_coord + PROMPT_PADDING;
     const int tmp_y = y_coord + HEADER_HEIGHT + 3;
 
     mvprint(tmp_x + 18, tmp_y - 1, BOLD, "%s PLAYERID : %s", ID_EMOJI, guestId);
-    display_progress_bar(x_coord, tmp_y + 1, "Gameplay loading please wait");
+    if (!display_progress_bar(x_coord, tmp_y + 1, "Gameplay loading please wait", &task)) {
+        print_error(tmp_x, tmp_y + 5, "Failed to load the questions!...");
+        cgetch();
+        return scene_return(SCENE_HOMEPAGE);
+    }
 
     memset(heading, 0, sizeof(heading));
     snprintf(heading, BUF_SIZE, " QUIZBIT ━━ %s TEST ", category);
@@ -306,20 +1137,15 @@ void play_as_guest(const int BOX_OFFSET) {
 
     do {
         draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
-        display_header(BOX_OFFSET, heading, NULL);
-        display_footer(BOX_OFFSET);
+        display_header(box_offset, heading, NULL);
+        display_footer(box_offset);
 
         mvprint(tmp_x + 18, tmp_y - 1, BOLD, "%s PLAYERID : %s", ID_EMOJI, guestId);
 
-        questions[qid].question_id = (int)qid + 1;
-        mvprint(tmp_x, tmp_y + 1, BOLD, "%i.) %s", questions[qid].question_id, questions[qid].question);
-
-        for (size_t i = 0; i < MAX_CHOICES; ++i) {
-            mvprint(tmp_x + 3, tmp_y + i + 2, BOLD, "%s", questions[qid].choices[i]);
-        }
+        draw_question(tmp_x, tmp_y + 1, &questions[qid], qid + 1);
         mvprint(tmp_x, tmp_y + 8, BOLD, " PRESS [S] TO SKIP THE QUESTION");
 
-        const uint32_t check = check_answer(questions, qid);
+        const uint32_t check = check_answer(&questions[qid], false);
         if (check == SKIP) {
             skipped += 1;
         } else {
@@ -335,5 +1161,5 @@ void play_as_guest(const int BOX_OFFSET) {
 
     mvprint(tmp_x, tmp_y + 17, BOLD, "Press any key to go back to the main menu : ");
     cgetch();
-    homepage(BOX_OFFSET);
+    return scene_return(SCENE_HOMEPAGE);
 }
\ No newline at end of file
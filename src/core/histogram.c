@@ -0,0 +1,180 @@
+#include "../../include/histogram.h"
+#include "../../include/utilities.h"
+
+
+/**
+ * @returns The bin counting a value, the bins of a power of two split it in HIST_SUB equal parts
+ */
+static size_t hist_bin(uint32_t value) {
+    if (value >= 1U << HIST_BITS) {
+        value = (1U << HIST_BITS) - 1;
+    }
+    if (value < HIST_SUB) {
+        return value;
+    }
+    const unsigned msb = 31U - (unsigned)__builtin_clz(value);
+    return (msb - 1) * HIST_SUB + ((value >> (msb - 2)) & (HIST_SUB - 1));
+}
+
+
+/**
+ * @returns The lowest value counted in a bin
+ */
+static uint32_t hist_bin_low(const size_t bin) {
+    if (bin < HIST_SUB) {
+        return (uint32_t)bin;
+    }
+    const unsigned msb = (unsigned)(bin / HIST_SUB) + 1;
+    return (uint32_t)(HIST_SUB + bin % HIST_SUB) << (msb - 2);
+}
+
+
+/**
+ * @returns The middle of the values counted in a bin, which a percentile falling in it is reported as
+ */
+static uint32_t hist_bin_mid(const size_t bin) {
+    const uint32_t low = hist_bin_low(bin);
+    const uint32_t width = bin < HIST_SUB ? 1 : 1U << (bin / HIST_SUB - 1);
+    return low + (width - 1) / 2;
+}
+
+
+/**
+ * @brief This function counts a value in a histogram
+ *
+ * @param hist A pointer to the histogram
+ * @param value The value (ie: milliseconds taken to answer a question)
+ */
+void hist_record(histogram_t *hist, const uint32_t value) {
+    hist->bins[hist_bin(value)] += 1;
+    hist->count += 1;
+    if (value > hist->max) {
+        hist->max = value;
+    }
+}
+
+
+/**
+ * @brief This function adds the values of a histogram to another one, as if they were recorded in it
+ *
+ * @param dest A pointer to the histogram receiving the values
+ * @param src A pointer to the histogram whose values are added
+ */
+void hist_merge(histogram_t *dest, const histogram_t *src) {
+    for (size_t i = 0; i < HIST_BINS; i++) {
+        dest->bins[i] += src->bins[i];
+    }
+    dest->count += src->count;
+    if (src->max > dest->max) {
+        dest->max = src->max;
+    }
+}
+
+
+/**
+ * @brief This function estimates a percentile of the values of a histogram, from the bin it falls in
+ *
+ * @param hist A pointer to the histogram
+ * @param fraction The percentile as a fraction, ie: 0.9 for the 90th percentile
+ *
+ * @returns The estimated value, or 0 if the histogram is empty
+ */
+uint32_t hist_percentile(const histogram_t *hist, const double fraction) {
+    if (hist->count == 0) {
+        return 0;
+    }
+    if (fraction >= 1.0) {
+        return hist->max;
+    }
+
+    const double wanted = ceil(fraction * hist->count);
+    const uint64_t rank = wanted < 1.0 ? 1 : (uint64_t)wanted;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < HIST_BINS; i++) {
+        seen += hist->bins[i];
+        if (seen >= rank) {
+            const uint32_t mid = hist_bin_mid(i);
+            return mid < hist->max ? mid : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+
+/**
+ * @brief This function writes a value in 4 little-endian bytes
+ */
+static void put_u32(uint8_t *bytes, const uint32_t value) {
+    for (size_t i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+
+/**
+ * @returns The value of 4 little-endian bytes
+ */
+static uint32_t get_u32(const uint8_t *bytes) {
+    return (uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+}
+
+
+/**
+ * @brief This function writes a histogram the way it is saved in the database : a version byte, the number of bins
+ *        (u16), the count & the max, then the bins, all little-endian so the blob reads the same on every machine.
+ *
+ * @param hist A pointer to the histogram
+ * @param blob A pointer to the buffer receiving the saved histogram, of HIST_BLOB bytes
+ *
+ * @returns The number of bytes written
+ */
+size_t hist_save(const histogram_t *hist, uint8_t *blob) {
+    blob[0] = HIST_VERSION;
+    blob[1] = (uint8_t)(HIST_BINS & 0xFF);
+    blob[2] = (uint8_t)(HIST_BINS >> 8);
+    put_u32(blob + 3, hist->count);
+    put_u32(blob + 7, hist->max);
+    for (size_t i = 0; i < HIST_BINS; i++) {
+        put_u32(blob + HIST_HEADER + 4 * i, hist->bins[i]);
+    }
+    return HIST_BLOB;
+}
+
+
+/**
+ * @brief This function reads a histogram saved in the database. A histogram saved with fewer bins keeps them,
+ *        the bins are the same for the values they can count; one saved with more bins has the extra ones
+ *        merged into the last bin, like the values past HIST_BITS. A blob without the header of HIST_VERSION is corrupt.
+ *
+ * @param hist A pointer to the histogram receiving the values
+ * @param data A pointer to the saved histogram
+ * @param size The number of bytes saved
+ *
+ * @returns true if the saved histogram is valid, otherwise false & the histogram is emptied
+ */
+bool hist_load(histogram_t *hist, const void *data, const size_t size) {
+    memset(hist, 0, sizeof(*hist));
+    const uint8_t *blob = data;
+    if (blob == NULL || size < HIST_HEADER || blob[0] != HIST_VERSION) {
+        return false;
+    }
+    const size_t saved = (size_t)blob[1] | (size_t)blob[2] << 8;
+    if (size != HIST_HEADER + 4 * saved) {
+        return false;
+    }
+    hist->count = get_u32(blob + 3);
+    hist->max = get_u32(blob + 7);
+    for (size_t i = 0; i < saved; i++) {
+        hist->bins[i < HIST_BINS ? i : HIST_BINS - 1] += get_u32(blob + HIST_HEADER + 4 * i);
+    }
+
+    uint64_t count = 0;
+    for (size_t i = 0; i < HIST_BINS; i++) {
+        count += hist->bins[i];
+    }
+    if (count != hist->count) {
+        memset(hist, 0, sizeof(*hist));
+        return false;
+    }
+    return true;
+}
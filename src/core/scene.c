@@ -0,0 +1,123 @@
+#include "../../include/scene.h"
+#include "../../include/db.h"
+#include "../../include/crash.h"
+
+
+//? The function of every scene, indexed by its id
+static const scene_t SCENES[SCENE_COUNT] = {
+    [SCENE_HOMEPAGE]       = homepage,
+    [SCENE_LOGIN]          = login,
+    [SCENE_SIGNUP]         = signup,
+    [SCENE_GUEST_MODE]     = guestplayer_mode,
+    [SCENE_GUEST_GAME]     = play_as_guest,
+    [SCENE_MAINMENU]       = mainmenu,
+    [SCENE_HELP]           = display_help,
+    [SCENE_GAMEPLAY]       = gameplay,
+    [SCENE_QUESTIONS]      = display_questions,
+    [SCENE_SETTINGS]       = settings,
+    [SCENE_SCOREBOARD]     = display_scoreboard,
+    [SCENE_GAMESTATS]      = display_gamestats,
+    [SCENE_MANAGE_ACCOUNT] = manage_account,
+    [SCENE_MODIFY_ACCOUNT] = modify_account,
+    [SCENE_EDIT_ACCOUNT]   = edit_account,
+    [SCENE_DELETE_ACCOUNT] = delete_account,
+    [SCENE_RESET_ACCOUNT]  = reset_account_data,
+};
+
+
+/**
+ * @returns The transition entering a scene on top of the current one
+ */
+transition_t scene_push(const scenes_t scene) {
+    return (transition_t){.action = GOTO_PUSH, .scene = scene};
+}
+
+
+/**
+ * @returns The transition entering a scene in place of the current one
+ */
+transition_t scene_replace(const scenes_t scene) {
+    return (transition_t){.action = GOTO_REPLACE, .scene = scene};
+}
+
+
+/**
+ * @returns The transition going back to the scene below the current one
+ */
+transition_t scene_back(void) {
+    return (transition_t){.action = GOTO_BACK, .scene = SCENE_NONE};
+}
+
+
+/**
+ * @returns The transition going back to a scene below the current one, ie: the main menu from a submenu
+ */
+transition_t scene_return(const scenes_t scene) {
+    return (transition_t){.action = GOTO_RETURN, .scene = scene};
+}
+
+
+/**
+ * @returns The transition ending the game
+ */
+transition_t scene_quit(void) {
+    return (transition_t){.action = GOTO_QUIT, .scene = SCENE_NONE};
+}
+
+
+/**
+ * @brief This function runs the scenes of the game in one dispatch loop, starting from the given scene.
+ *        The scene on top of the stack is run & the transition it returns is applied to the stack,
+ *        until a scene quits or goes back from the bottom of the stack.
+ *
+ * @param session A pointer to the state shared by the scenes
+ * @param first The first scene, at the bottom of the stack
+ */
+void scene_run(session_t *session, const scenes_t first) {
+    scenes_t stack[SCENE_STACK];
+    size_t depth = 0;
+    stack[depth++] = first;
+
+    while (depth > 0) {
+        const scenes_t current = stack[depth - 1];
+        if (current <= SCENE_NONE || current >= SCENE_COUNT || SCENES[current] == NULL) {
+            log_error(__func__, __FILE__, __LINE__, "Unknown scene %i, quitting!...\n", current);
+            return;
+        }
+
+        crash_event(CRASH_SCENE, (int32_t)current, (int32_t)depth);
+        const transition_t next = SCENES[current](session);
+        switch (next.action) {
+            case GOTO_PUSH :
+                if (depth == SCENE_STACK) {
+                    log_error(__func__, __FILE__, __LINE__, "Scene stack is full, replacing scene %i!...\n", current);
+                    stack[depth - 1] = next.scene;
+                }
+                else {
+                    stack[depth++] = next.scene;
+                }
+            break;
+
+            case GOTO_REPLACE :
+                stack[depth - 1] = next.scene;
+            break;
+
+            case GOTO_BACK :
+                depth -= 1;
+            break;
+
+            case GOTO_RETURN :
+                while (depth > 0 && stack[depth - 1] != next.scene) {
+                    depth -= 1;
+                }
+                if (depth == 0) {
+                    stack[depth++] = next.scene;
+                }
+            break;
+
+            case GOTO_QUIT :
+            default :
+                return;
+        }
+    }
+}
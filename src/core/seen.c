@@ -0,0 +1,240 @@
+#include "../../include/seen.h"
+#include "../../include/utilities.h"
+
+
+/**
+ * @returns The slot an id is looked up from, its hash spreads the close ids of a bank over the slots
+ */
+static size_t seen_slot(const uint32_t id) {
+    return (size_t)((id * 0x9E3779B1U) >> 20) & (SEEN_SLOTS - 1);
+}
+
+
+/**
+ * @brief This function puts an id in the hash of a set
+ *
+ * @param seen A pointer to the set
+ * @param id The id, not in the hash yet
+ */
+static void seen_insert(seen_t *seen, const uint32_t id) {
+    size_t slot = seen_slot(id);
+    while (seen->slots[slot] != 0) {
+        slot = (slot + 1) & (SEEN_SLOTS - 1);
+    }
+    seen->slots[slot] = id;
+}
+
+
+/**
+ * @brief This function drops the older generation of a set, the newer one becomes the older
+ *
+ * @param seen A pointer to the set
+ */
+static void seen_rotate(seen_t *seen) {
+    const uint32_t newer = seen->count - seen->older;
+    memmove(seen->ids, seen->ids + seen->older, newer * sizeof(uint32_t));
+    seen->older = newer;
+    seen->count = newer;
+    seen->marked = 0;
+
+    memset(seen->slots, 0, sizeof(seen->slots));
+    for (uint32_t i = 0; i < seen->count; i++) {
+        seen_insert(seen, seen->ids[i]);
+    }
+}
+
+
+/**
+ * @brief This function empties a set
+ *
+ * @param seen A pointer to the set
+ */
+void seen_clear(seen_t *seen) {
+    memset(seen->slots, 0, sizeof(seen->slots));
+    seen->older = 0;
+    seen->count = 0;
+    seen->marked = 0;
+}
+
+
+/**
+ * @returns true if an id is in a set, otherwise false
+ */
+bool seen_has(const seen_t *seen, const uint32_t id) {
+    if (id == 0) {
+        return false;
+    }
+    for (size_t slot = seen_slot(id); seen->slots[slot] != 0; slot = (slot + 1) & (SEEN_SLOTS - 1)) {
+        if (seen->slots[slot] == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief This function adds the id of a question shown to the player to a set
+ *
+ * @param seen A pointer to the set
+ * @param id The id of the question
+ * @param limit The number of ids the sampler may skip, at most SEEN_MAX. Half of the bank keeps the sampler
+ *              drawing 2 ids per question at most, each generation holds half of the limit.
+ */
+void seen_add(seen_t *seen, const uint32_t id, const uint32_t limit) {
+    if (id == 0 || seen_has(seen, id)) {
+        return;
+    }
+    const uint32_t bounded = limit < SEEN_MAX ? limit : SEEN_MAX;
+    const uint32_t generation = bounded / 2 > 0 ? bounded / 2 : 1;
+    while (seen->count - seen->older >= generation || seen->count >= SEEN_MAX) {
+        seen_rotate(seen);
+    }
+    seen->ids[seen->count++] = id;
+    seen_insert(seen, id);
+}
+
+
+/**
+ * @brief This function puts an id in the hash of a set only, so the sampler skips it without it being saved,
+ *        ie: the questions already drawn in the game
+ *
+ * @param seen A pointer to the set
+ * @param id The id of the question
+ *
+ * @returns true if the id is marked, otherwise false if the hash is too full for it
+ */
+bool seen_mark(seen_t *seen, const uint32_t id) {
+    if (id == 0 || seen_has(seen, id)) {
+        return true;
+    }
+    //? A quarter of the slots stay empty, so the lookups stay short
+    if ((seen->count + seen->marked + 1) * 4 > SEEN_SLOTS * 3) {
+        return false;
+    }
+    seen->marked += 1;
+    seen_insert(seen, id);
+    return true;
+}
+
+
+/**
+ * @returns The order of two ids
+ */
+static int compare_ids(const void *a, const void *b) {
+    const uint32_t lhs = *(const uint32_t *)a, rhs = *(const uint32_t *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+
+/**
+ * @returns The number of bytes the value is written in (7 bits each), or 0 if the buffer is too small
+ */
+static size_t write_varint(uint8_t *buffer, const size_t size, uint32_t value) {
+    size_t n = 0;
+    do {
+        if (n == size) {
+            return 0;
+        }
+        buffer[n++] = (uint8_t)((value & 0x7F) | (value > 0x7F ? 0x80 : 0));
+        value >>= 7;
+    } while (value > 0);
+    return n;
+}
+
+
+/**
+ * @returns The number of bytes the value is read from, or 0 if it is cut or too large
+ */
+static size_t read_varint(const uint8_t *buffer, const size_t size, uint32_t *value) {
+    uint64_t result = 0;
+    for (size_t n = 0; n < size && n < 5; n++) {
+        result |= (uint64_t)(buffer[n] & 0x7F) << (7 * n);
+        if ((buffer[n] & 0x80) == 0) {
+            if (result > UINT32_MAX) {
+                return 0;
+            }
+            *value = (uint32_t)result;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+
+/**
+ * @brief This function encodes a set to be saved : the sizes of its generations, then the ids of each one sorted
+ *        & written as the differences to the previous id, in as few bytes as they need
+ *
+ * @param seen A pointer to the set
+ * @param buffer A pointer to the buffer receiving the set, SEEN_BLOB bytes are always enough
+ * @param size The size of the buffer
+ *
+ * @returns The number of bytes written, or 0 if the buffer is too small
+ */
+size_t seen_save(const seen_t *seen, uint8_t *buffer, const size_t size) {
+    uint32_t sorted[SEEN_MAX];
+    memcpy(sorted, seen->ids, seen->count * sizeof(uint32_t));
+    qsort(sorted, seen->older, sizeof(uint32_t), compare_ids);
+    qsort(sorted + seen->older, seen->count - seen->older, sizeof(uint32_t), compare_ids);
+
+    size_t used = write_varint(buffer, size, seen->older);
+    size_t n = used > 0 ? write_varint(buffer + used, size - used, seen->count - seen->older) : 0;
+    used = n > 0 ? used + n : 0;
+
+    for (uint32_t i = 0, previous = 0; used > 0 && i < seen->count; i++) {
+        previous = i == seen->older ? 0 : previous;
+        n = write_varint(buffer + used, size - used, sorted[i] - previous);
+        used = n > 0 ? used + n : 0;
+        previous = sorted[i];
+    }
+    return used;
+}
+
+
+/**
+ * @brief This function decodes a saved set
+ *
+ * @param seen A pointer to the set receiving the ids
+ * @param data A pointer to the saved set
+ * @param size The number of bytes saved
+ *
+ * @returns true if the saved set is valid, otherwise false & the set is emptied
+ */
+bool seen_load(seen_t *seen, const void *data, const size_t size) {
+    seen_clear(seen);
+    if (data == NULL || size == 0) {
+        return false;
+    }
+
+    const uint8_t *bytes = data;
+    uint32_t older = 0, newer = 0;
+    size_t used = read_varint(bytes, size, &older);
+    size_t n = used > 0 ? read_varint(bytes + used, size - used, &newer) : 0;
+    if (n == 0 || older > SEEN_MAX || newer > SEEN_MAX - older) {
+        return false;
+    }
+    used += n;
+
+    //? The ids of a generation are increasing, so an id read twice means the set is corrupted
+    for (uint32_t i = 0, previous = 0; i < older + newer; i++) {
+        uint32_t delta = 0;
+        n = read_varint(bytes + used, size - used, &delta);
+        previous = i == older ? 0 : previous;
+        if (n == 0 || delta == 0 || delta > UINT32_MAX - previous || seen_has(seen, previous + delta)) {
+            seen_clear(seen);
+            return false;
+        }
+        used += n;
+        previous += delta;
+        seen->ids[seen->count++] = previous;
+        seen_insert(seen, previous);
+    }
+    seen->older = older;
+
+    if (used != size) {
+        seen_clear(seen);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,75 @@
+#include "../../include/timing.h"
+#include "../../include/utilities.h"
+
+
+/**
+ * @returns The current time of the monotonic clock in nanoseconds
+ */
+uint64_t timing_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+
+/**
+ * @returns A duration in nanoseconds converted to milliseconds, rounded to the nearest
+ */
+uint32_t timing_ms(const uint64_t ns) {
+    const uint64_t ms = (ns + 500000U) / 1000000U;
+    return ms < UINT32_MAX ? (uint32_t)ms : UINT32_MAX;
+}
+
+
+/**
+ * @brief This function starts the timing of a game
+ *
+ * @param timing A pointer to the timing of the game
+ */
+void timing_start(gtiming_t *timing) {
+    *timing = (gtiming_t){.started = timing_now(), .shown = 0, .elapsed = 0, .answering = 0, .answered = 0};
+    timing->shown = timing->started;
+}
+
+
+/**
+ * @brief This function marks a question as shown to the player, the time taken to answer it starts now
+ *
+ * @param timing A pointer to the timing of the game
+ */
+void timing_shown(gtiming_t *timing) {
+    timing->shown = timing_now();
+}
+
+
+/**
+ * @brief This function marks the question shown as answered (or skipped)
+ *
+ * @param timing A pointer to the timing of the game
+ *
+ * @returns The time taken to answer the question in milliseconds
+ */
+uint32_t timing_answered(gtiming_t *timing) {
+    const uint64_t latency = timing_now() - timing->shown;
+    timing->answering += latency;
+    timing->answered += 1;
+    return timing_ms(latency);
+}
+
+
+/**
+ * @brief This function stops the timing of a game
+ *
+ * @param timing A pointer to the timing of the game
+ */
+void timing_stop(gtiming_t *timing) {
+    timing->elapsed = timing_now() - timing->started;
+}
+
+
+/**
+ * @returns The length of a stopped game in seconds, which the bonuses, badges & stats are computed from
+ */
+double timing_seconds(const gtiming_t *timing) {
+    return (double)timing->elapsed / 1e9;
+}
@@ -80,20 +80,23 @@ bool init_new_player_stats(pstats_t *newPlayer, account_t *newAccount) {
 
 /**
  * @brief This function randomly generates a new player ID after a new signup.
+ *        The IDs come from their own generator seeded from entropy, never from QUIZBIT_SEED,
+ *        so the accounts created by replayed sessions don't get the same IDs.
  *
  * @param id A pointer to the 'id' array to store the generated player ID.
  */
 void assign_new_player_id(char *id) {
-    static int seeded = 0;
+    static rng_t rng;
+    static bool seeded = false;
     if (!seeded) {
-        srand(time(NULL));
-        seeded = 1;
+        rng_entropy(&rng);
+        seeded = true;
     }
     id[0] = 'p';
     id[1] = 'l';
     id[2] = '-';
     for (int i = 3; i < ID_SIZE - 1; ++i) {
-        id[i] = '0' + rand() % 10;
+        id[i] = (char)('0' + rng_below(&rng, 10));
     }
     id[ID_SIZE - 1] = NULL_TERM;
 }
\ No newline at end of file
@@ -2,12 +2,89 @@
 #include "../../include/gamecore.h"
 
 
+//? The text of a choice without the letter it was saved with, ie: "[A]. Atom" or "[A] Atom"
+#define STRIP_LETTER(column) \
+    "CASE WHEN " column " GLOB '[[][A-D]]. *' THEN substr(" column ", 6) " \
+    "WHEN " column " GLOB '[[][A-D]] *' THEN substr(" column ", 5) ELSE " column " END"
+
+
+/**
+ * @brief This function migrates a table of questions saved with the letters of their choices (ie: "[A]. Atom"),
+ *        & the text of the correct choice, to the choices without letters & the index of the correct one.
+ *        The choices are shuffled in every game, so their letters are only given when they are shown.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param tableName A pointer to the name of the table of questions.
+ *
+ * @returns true if the table is migrated or doesn't need to be, otherwise false.
+ */
+static bool migrate_question_table(sqlite3 *db, const char *tableName) {
+    char sqlQUERY[MAX_BUFF];
+    snprintf(sqlQUERY, sizeof(sqlQUERY), "SELECT 1 FROM pragma_table_info('%s') WHERE name = 'correct_choice';", tableName);
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v3(db, sqlQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+        return false;
+    }
+    const bool migrate = sqlite3_step(stmt) == SQLITE_ROW;
+    sqlite3_finalize(stmt);
+    if (!migrate) {
+        return true;
+    }
+
+    //? The letter of the correct choice is kept unless its text names another choice
+    const char *migrateQUERY[] = {
+        "ALTER TABLE %s ADD COLUMN correct INTEGER NOT NULL DEFAULT 0;",
+        "UPDATE %s SET correct = max(instr('ABCD', substr(correct_choice, 2, 1)) - 1, 0);",
+        "UPDATE %s SET choice_a = " STRIP_LETTER("choice_a") ", choice_b = " STRIP_LETTER("choice_b") ","
+                      "choice_c = " STRIP_LETTER("choice_c") ", choice_d = " STRIP_LETTER("choice_d") ","
+                      "correct_choice = " STRIP_LETTER("correct_choice") ";",
+        "UPDATE %s SET correct = CASE correct_choice WHEN choice_a THEN 0 WHEN choice_b THEN 1 "
+                      "WHEN choice_c THEN 2 WHEN choice_d THEN 3 ELSE correct END;"
+    };
+
+    //? The text of the correct choice is dropped by rebuilding the table, DROP COLUMN needs SQLite 3.35 or later
+    char rebuildSQL[MAX_BUFF * 2];
+    snprintf(rebuildSQL, sizeof(rebuildSQL),
+             "CREATE TABLE migrated_questions (question_id INTEGER UNIQUE PRIMARY KEY, question TEXT NOT NULL,"
+             "choice_a TEXT NOT NULL, choice_b TEXT NOT NULL, choice_c TEXT NOT NULL, choice_d TEXT NOT NULL,"
+             "correct INTEGER NOT NULL);"
+             "INSERT INTO migrated_questions SELECT question_id, question, choice_a, choice_b, choice_c, choice_d, correct "
+             "FROM %s;"
+             "DROP TABLE %s;"
+             "ALTER TABLE migrated_questions RENAME TO %s;", tableName, tableName, tableName);
+
+    char *errMsg = NULL;
+    bool ret = sqlite3_exec(db, "BEGIN;", NO_CALLBACK, NO_ERR_MSSG, &errMsg) == SQLITE_OK;
+    for (size_t i = 0; ret && i < sizeof(migrateQUERY) / sizeof(migrateQUERY[0]); i++) {
+        char migrateSQL[MAX_BUFF * 8];
+        snprintf(migrateSQL, sizeof(migrateSQL), migrateQUERY[i], tableName);
+        ret = sqlite3_exec(db, migrateSQL, NO_CALLBACK, NO_ERR_MSSG, &errMsg) == SQLITE_OK;
+    }
+    ret = ret && sqlite3_exec(db, rebuildSQL, NO_CALLBACK, NO_ERR_MSSG, &errMsg) == SQLITE_OK;
+    ret = ret && sqlite3_exec(db, "COMMIT;", NO_CALLBACK, NO_ERR_MSSG, &errMsg) == SQLITE_OK;
+
+    if (!ret) {
+        fprintf(stderr, " [%s] Error migrating '%s' table : errMsg => %s!...\n", WARNING_EMOJI, tableName, errMsg);
+        sqlite3_free(errMsg);
+        sqlite3_exec(db, "ROLLBACK;", NO_CALLBACK, NO_ERR_MSSG, NULL);
+        return false;
+    }
+    print(" [%s] Migrated the choices of the '%s' table!...\n", SUCCESS_EMOJI, tableName);
+    return true;
+}
+
+
 /**
  * @brief This function creates a new database for the game and initializes necessary tables.
- *        The function creates 5 tables : 'users' to store user details after signing up,
+ *        The function creates 11 tables : 'users' to store user details after signing up,
  *        'players' and 'badges' table to keep track of player records,
+ *        'games' and 'answers' to keep the result of every game & the time taken on each of its questions,
+ *        'player_latency' and 'question_stats' to keep the histograms of the answer times of every player & question,
+ *        'seen_questions' to keep the questions each player has seen lately in every category,
  *        and three additional tables to store questions from three different categories,
- *        along with their answers, and correct choice.
+ *        along with their choices, and the index of the correct one.
  *
  * @returns true if the database and it's tables are successflly created, otherwise false.
  */
@@ -69,6 +146,52 @@ bool create_new_database(void) {
 
                         "FOREIGN KEY (player_id) REFERENCES accounts(player_id)"
         ");",
+        "CREATE TABLE IF NOT EXISTS games ("
+                        "game_id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                        "player_id TEXT NOT NULL,"
+                        "category TEXT NOT NULL,"
+
+                        "score INTEGER NOT NULL,"
+                        "bonus INTEGER NOT NULL,"
+                        "skipped INTEGER NOT NULL,"
+                        "questions INTEGER NOT NULL,"
+
+                        "duration_ms INTEGER NOT NULL,"
+                        "answering_ms INTEGER NOT NULL,"
+                        "played_at TEXT NOT NULL DEFAULT CURRENT_TIMESTAMP,"
+                        "FOREIGN KEY (player_id) REFERENCES accounts(player_id)"
+        ");",
+        "CREATE INDEX IF NOT EXISTS games_player ON games (player_id);",
+        "CREATE TABLE IF NOT EXISTS answers ("
+                        "game_id INTEGER NOT NULL,"
+                        "category TEXT NOT NULL,"
+                        "question_id INTEGER NOT NULL,"
+                        "outcome INTEGER NOT NULL,"
+                        "latency_ms INTEGER NOT NULL,"
+                        "FOREIGN KEY (game_id) REFERENCES games(game_id)"
+        ");",
+        "CREATE INDEX IF NOT EXISTS answers_game ON answers (game_id);",
+        "CREATE TABLE IF NOT EXISTS player_latency ("
+                        "player_id TEXT NOT NULL UNIQUE PRIMARY KEY,"
+                        "histogram BLOB NOT NULL,"
+                        "FOREIGN KEY (player_id) REFERENCES accounts(player_id)"
+        ");",
+        "CREATE TABLE IF NOT EXISTS question_stats ("
+                        "category TEXT NOT NULL,"
+                        "question_id INTEGER NOT NULL,"
+                        "shown INTEGER NOT NULL,"
+                        "skipped INTEGER NOT NULL,"
+                        "correct INTEGER NOT NULL,"
+                        "histogram BLOB NOT NULL,"
+                        "PRIMARY KEY (category, question_id)"
+        ");",
+        "CREATE TABLE IF NOT EXISTS seen_questions ("
+                        "player_id TEXT NOT NULL,"
+                        "category TEXT NOT NULL,"
+                        "seen BLOB NOT NULL,"
+                        "PRIMARY KEY (player_id, category),"
+                        "FOREIGN KEY (player_id) REFERENCES accounts(player_id)"
+        ");",
 
             "CREATE TABLE IF NOT EXISTS Science ("
                         "question_id INTEGER UNIQUE PRIMARY KEY,"
@@ -77,7 +200,7 @@ bool create_new_database(void) {
                         "choice_b TEXT NOT NULL,"
                         "choice_c TEXT NOT NULL,"
                         "choice_d TEXT NOT NULL,"
-                        "correct_choice TEXT NOT NULL"
+                        "correct INTEGER NOT NULL"
             ");",
 
             "CREATE TABLE IF NOT EXISTS Sports ("
@@ -87,7 +210,7 @@ bool create_new_database(void) {
                         "choice_b TEXT NOT NULL,"
                         "choice_c TEXT NOT NULL,"
                         "choice_d TEXT NOT NULL,"
-                        "correct_choice TEXT NOT NULL"
+                        "correct INTEGER NOT NULL"
             ");",
 
             "CREATE TABLE IF NOT EXISTS Basics ("
@@ -97,7 +220,7 @@ bool create_new_database(void) {
                         "choice_b TEXT NOT NULL,"
                         "choice_c TEXT NOT NULL,"
                         "choice_d TEXT NOT NULL,"
-                        "correct_choice TEXT NOT NULL"
+                        "correct INTEGER NOT NULL"
             ");"
     };
 
@@ -112,6 +235,14 @@ bool create_new_database(void) {
             return false;
         }
     }
+
+    const char *questionTables[] = {"Science", "Sports", "Basics"};
+    for (size_t i = 0; i < sizeof(questionTables) / sizeof(questionTables[0]); i++) {
+        if (!migrate_question_table(db, questionTables[i])) {
+            sqlite3_close(db);
+            return false;
+        }
+    }
     sqlite3_close(db);
     return true;
 }
@@ -290,6 +421,60 @@ bool retrieve_accounts_table(sqlite3 *db, account_t *player, const char *usernam
 }
 
 
+/**
+ * @brief This function copies one row of the 'players' table columns into the player stats structure
+ *        The columns must be selected in the same order as they are declared in the 'players' table
+ *
+ * @param stmt A pointer to the stepped statement holding the row
+ * @param playerData A pointer to the player stats structure to fill
+ * @param col Index of the 'player_id' column in the result set
+ */
+static void read_players_columns(sqlite3_stmt *stmt, pstats_t *playerData, const int col) {
+    snprintf(playerData->profile.playerId, ID_SIZE, "%s", (const char *)sqlite3_column_text(stmt, col));
+    snprintf(playerData->profile.username, UNAME_SIZE, "%s", (const char *)sqlite3_column_text(stmt, col + 1));
+    playerData->treasure.totalGoldCoins = sqlite3_column_int(stmt, col + 2);
+    playerData->treasure.totalMoneyBags = sqlite3_column_int(stmt, col + 3);
+    playerData->treasure.totalGemStones = sqlite3_column_int(stmt, col + 4);
+
+    playerData->scores.currentScore = sqlite3_column_int(stmt, col + 5);
+    playerData->scores.averageScore = sqlite3_column_int(stmt, col + 6);
+    playerData->scores.highestScore = sqlite3_column_int(stmt, col + 7);
+
+    playerData->stats.longestStreak = sqlite3_column_int(stmt, col + 8);
+    playerData->stats.timeSpentPerGame = sqlite3_column_int(stmt, col + 9);
+    playerData->stats.totalGamesPlayed = sqlite3_column_int(stmt, col + 10);
+
+    playerData->stats.performanceRate = sqlite3_column_int(stmt, col + 11);
+    playerData->stats.quizCompletionRate = sqlite3_column_int(stmt, col + 12);
+    playerData->stats.totalGamesCompleted = sqlite3_column_int(stmt, col + 13);
+
+    playerData->answers.totalCorrectAnswers = sqlite3_column_int(stmt, col + 14);
+    playerData->answers.totalIncorrectAnswers = sqlite3_column_int(stmt, col + 15);
+    playerData->answers.totalQuestionAttempted = sqlite3_column_int(stmt, col + 16);
+    snprintf(playerData->profile.date, DATE_SIZE, "%s", (const char *)sqlite3_column_text(stmt, col + 17));
+}
+
+
+/**
+ * @brief This function copies the badge columns of one row of the 'badges' table into the player stats structure
+ *
+ * @param stmt A pointer to the stepped statement holding the row
+ * @param playerData A pointer to the player stats structure to fill
+ * @param col Index of the 'rocket' column in the result set
+ */
+static void read_badges_columns(sqlite3_stmt *stmt, pstats_t *playerData, const int col) {
+    playerData->badge.rocket = sqlite3_column_int(stmt, col);
+    playerData->badge.shield = sqlite3_column_int(stmt, col + 1);
+    playerData->badge.trophy = sqlite3_column_int(stmt, col + 2);
+    playerData->badge.starter = sqlite3_column_int(stmt, col + 3);
+
+    playerData->badge.bullseye = sqlite3_column_int(stmt, col + 4);
+    playerData->badge.glowingStar = sqlite3_column_int(stmt, col + 5);
+    playerData->badge.hundredPoints = sqlite3_column_int(stmt, col + 6);
+    playerData->badge.perfectionist = sqlite3_column_int(stmt, col + 7);
+}
+
+
 /**
  * @brief This functions retrieves stats of the currently logged-in player from the 'players' table
  *
@@ -322,28 +507,7 @@ bool retrieve_players_table(sqlite3 *db, pstats_t *playerData, const char *usern
     const int step = sqlite3_step(stmt);
     //? Retrieve data from the result set and store it in the account_t structure
     if (step == SQLITE_ROW) {
-        snprintf(playerData->profile.playerId, ID_SIZE, "%s", (const char *)sqlite3_column_text(stmt, 0));
-        snprintf(playerData->profile.username, UNAME_SIZE, "%s", (const char *)sqlite3_column_text(stmt, 1));
-        playerData->treasure.totalGoldCoins = sqlite3_column_int(stmt, 2);
-        playerData->treasure.totalMoneyBags = sqlite3_column_int(stmt, 3);
-        playerData->treasure.totalGemStones = sqlite3_column_int(stmt, 4);
-
-        playerData->scores.currentScore = sqlite3_column_int(stmt, 5);
-        playerData->scores.averageScore = sqlite3_column_int(stmt, 6);
-        playerData->scores.highestScore = sqlite3_column_int(stmt, 7);
-
-        playerData->stats.longestStreak = sqlite3_column_int(stmt, 8);
-        playerData->stats.timeSpentPerGame = sqlite3_column_int(stmt, 9);
-        playerData->stats.totalGamesPlayed = sqlite3_column_int(stmt, 10);
-
-        playerData->stats.performanceRate = sqlite3_column_int(stmt, 11);
-        playerData->stats.quizCompletionRate = sqlite3_column_int(stmt, 12);
-        playerData->stats.totalGamesCompleted = sqlite3_column_int(stmt, 13);
-
-        playerData->answers.totalCorrectAnswers = sqlite3_column_int(stmt, 14);
-        playerData->answers.totalIncorrectAnswers = sqlite3_column_int(stmt, 15);
-        playerData->answers.totalQuestionAttempted = sqlite3_column_int(stmt, 16);
-        snprintf(playerData->profile.date, DATE_SIZE, "%s", (const char *)sqlite3_column_text(stmt, 17));
+        read_players_columns(stmt, playerData, 0);
     }
     else if (step == SQLITE_DONE) {
         log_error(__func__, __FILE__, __LINE__, "No data found for username : {%s} ERR : %s\n", username, sqlite3_errmsg(db));
@@ -387,15 +551,7 @@ bool retrieve_badges_table(sqlite3 *db, pstats_t *playerData, const char *userna
 
     if (step == SQLITE_ROW) {
         //? Skip first two columns since it has been retrieved from the players table
-        playerData->badge.rocket = sqlite3_column_int(stmt, 2);
-        playerData->badge.shield = sqlite3_column_int(stmt, 3);
-        playerData->badge.trophy = sqlite3_column_int(stmt, 4);
-        playerData->badge.starter = sqlite3_column_int(stmt, 5);
-
-        playerData->badge.bullseye = sqlite3_column_int(stmt, 6);
-        playerData->badge.glowingStar = sqlite3_column_int(stmt, 7);
-        playerData->badge.hundredPoints = sqlite3_column_int(stmt, 8);
-        playerData->badge.perfectionist = sqlite3_column_int(stmt, 9);
+        read_badges_columns(stmt, playerData, 2);
     }
     else if (step == SQLITE_DONE) {
         log_error(__func__, __FILE__, __LINE__, "No data found for username : {%s}\n", username);
@@ -408,6 +564,61 @@ bool retrieve_badges_table(sqlite3 *db, pstats_t *playerData, const char *userna
 }
 
 
+/**
+ * @brief This function loads the full record of a player ('players' & 'badges' tables) with a single statement.
+ *        When a hashed password is given, the row is only returned if it matches the one in the 'accounts' table,
+ *        so the same statement both verifies the credentials and materializes the player stats.
+ *
+ * @param db A pointer to the sqlite3 db connection
+ * @param player A pointer to the player stats structure to fill
+ * @param username A pointer to the username of the player
+ * @param hashedPass A pointer to the hashed password to verify, or NULL to skip the verification
+ *
+ * @returns true if the record is found (and the password matches), otherwise false
+ */
+bool retrieve_player_record(sqlite3 *db, pstats_t *player, const char *username, const char *hashedPass) {
+    if (db == NULL || player == NULL || username == NULL) {
+        log_error(__func__, __FILE__, __LINE__, "Invalid input parameters!...\n");
+        return false;
+    }
+
+    const char *recordQUERY =
+        "SELECT p.player_id, p.username, p.goldcoin, p.moneybag, p.gemstone, p.current_score, p.average_score, "
+               "p.highest_score, p.longest_streak, p.average_playtime, p.total_games_played, "
+               "p.performanceRate, p.quizCompletionRate, p.totalGamesCompleted, p.correct_answers, "
+               "p.incorrect_answers, p.total_attempts, p.last_played_timestamp, "
+               "b.rocket, b.shield, b.trophy, b.starter, b.bulls_eye, b.glowing_star, b.hundred_points, b.perfectionist "
+        "FROM accounts a "
+        "JOIN players p ON p.username = a.username "
+        "JOIN badges b ON b.username = a.username "
+        "WHERE a.username = ?1 AND (?2 IS NULL OR a.password = ?2);";
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v3(db, recordQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+        return false;
+    }
+
+    if (sqlite3_bind_text(stmt, 1, username, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK ||
+        (hashedPass != NULL && sqlite3_bind_text(stmt, 2, hashedPass, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK)) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to bind parameters : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return false;
+    }
+
+    const int step = sqlite3_step(stmt);
+    if (step == SQLITE_ROW) {
+        read_players_columns(stmt, player, 0);
+        read_badges_columns(stmt, player, 18);
+    }
+    else if (step != SQLITE_DONE) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to execute statement : %s!...\n", sqlite3_errmsg(db));
+    }
+    sqlite3_finalize(stmt);
+    return step == SQLITE_ROW;
+}
+
+
 /**
  * @brief This function retrieves updated information of currently logged in player
  *        from the database and updates the player stats structure members accordingly.
@@ -422,21 +633,57 @@ bool get_player_data(const char *username, pstats_t *player) {
     sqlite3 *db = NULL;
     if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
         log_error(__func__, __FILE__, __LINE__, "Failed to open database : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
         return false;
     }
 
-    bool ret = true;
-    if (!retrieve_players_table(db, player, username)) {
-        log_error(__func__, __FILE__, __LINE__, "Failed to retrieve from 'players' table : %s!...\n", sqlite3_errmsg(db));
-        ret = false;
+    const bool ret = retrieve_player_record(db, player, username, NULL);
+    if (!ret) {
+        log_error(__func__, __FILE__, __LINE__, "No data found for username : {%s}\n", username);
     }
 
-    if (!retrieve_badges_table(db, player, username)) {
-        log_error(__func__, __FILE__, __LINE__, "Failed to retrieve from 'badges' table : %s!...\n", sqlite3_errmsg(db));
-        ret = false;
+    sqlite3_close(db);
+    return ret;
+}
+
+
+/**
+ * @brief This function verifies the login credentials of a player and loads the full player record
+ *        over a single database connection & statement. It is the shared fast path for signing in.
+ *
+ * @param username A pointer to the username to be verified.
+ * @param passwd A pointer to the plain text password to be verified.
+ * @param player A pointer to the player stats structure to store the player record.
+ *
+ * @returns true if the credentials are valid and the record is loaded, otherwise false.
+ */
+bool authenticate_player(const char *username, const char *passwd, pstats_t *player) {
+    if (username == NULL || passwd == NULL || player == NULL) {
+        log_error(__func__, __FILE__, __LINE__, "Invalid input parameters!...\n");
+        return false;
+    }
+
+    char *hashedPassword = sha256_hashpass(passwd);
+    if (hashedPassword == NULL) {
+        log_error(__func__, __FILE__, __LINE__, "[hPass] : %s\n", strerror(ENOMEM));
+        return false;
+    }
+
+    sqlite3 *db = NULL;
+    if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to open database : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        free(hashedPassword);
+        return false;
+    }
+
+    const bool ret = retrieve_player_record(db, player, username, hashedPassword);
+    if (!ret) {
+        struct_memset(player, sizeof(pstats_t));
     }
 
     sqlite3_close(db);
+    free(hashedPassword);
     return ret;
 }
 
@@ -683,6 +930,317 @@ bool update_gamestats(const pstats_t *player) {
     return true;
 }
 
+
+/**
+ * @brief This function reads the histogram of the answer times of a player.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param playerId A pointer to the id of the player.
+ * @param hist A pointer to the histogram receiving the answer times, empty if the player never answered.
+ *
+ * @returns true if the histogram is read, otherwise false.
+ */
+bool retrieve_player_latency(sqlite3 *db, const char *playerId, histogram_t *hist) {
+    memset(hist, 0, sizeof(*hist));
+
+    sqlite3_stmt *stmt = NULL;
+    const char *sqlQUERY = "SELECT histogram FROM player_latency WHERE player_id = ?;";
+    if (sqlite3_prepare_v3(db, sqlQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK ||
+        sqlite3_bind_text(stmt, 1, playerId, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return false;
+    }
+
+    const int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW &&
+        !hist_load(hist, sqlite3_column_blob(stmt, 0), (size_t)sqlite3_column_bytes(stmt, 0))) {
+        log_error(__func__, __FILE__, __LINE__, "Invalid answer times histogram of %s, it is ignored!...\n", playerId);
+    }
+    sqlite3_finalize(stmt);
+    return rc == SQLITE_ROW || rc == SQLITE_DONE;
+}
+
+
+/**
+ * @brief This function merges the answer times of a game into the histogram of the player.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param playerId A pointer to the id of the player.
+ * @param game A pointer to the histogram of the answer times of the game.
+ *
+ * @returns true if the histogram is saved, otherwise false.
+ */
+static bool update_player_latency(sqlite3 *db, const char *playerId, const histogram_t *game) {
+    histogram_t hist;
+    if (!retrieve_player_latency(db, playerId, &hist)) {
+        return false;
+    }
+    hist_merge(&hist, game);
+    uint8_t blob[HIST_BLOB];
+    const size_t size = hist_save(&hist, blob);
+
+    sqlite3_stmt *stmt = NULL;
+    const char *sqlQUERY = "INSERT OR REPLACE INTO player_latency (player_id, histogram) VALUES (?, ?);";
+    const bool ret = sqlite3_prepare_v3(db, sqlQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) == SQLITE_OK &&
+                     sqlite3_bind_text(stmt, 1, playerId, NULL_BYTE, SQLITE_TRANSIENT) == SQLITE_OK &&
+                     sqlite3_bind_blob(stmt, 2, blob, (int)size, SQLITE_TRANSIENT) == SQLITE_OK &&
+                     sqlite3_step(stmt) == SQLITE_DONE;
+    sqlite3_finalize(stmt);
+    return ret;
+}
+
+
+/**
+ * @brief This function counts an answered question in its stats, & merges its answer time into its histogram.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param category A pointer to the category of the question.
+ * @param answer A pointer to the answered question.
+ *
+ * @returns true if the stats are saved, otherwise false.
+ */
+static bool update_question_stats(sqlite3 *db, const char *category, const answer_t *answer) {
+    sqlite3_stmt *stmt = NULL;
+    const char *selectQUERY = "SELECT shown, skipped, correct, histogram FROM question_stats WHERE category = ? AND question_id = ?;";
+    if (sqlite3_prepare_v3(db, selectQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK ||
+        sqlite3_bind_text(stmt, 1, category, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK ||
+        sqlite3_bind_int(stmt, 2, answer->question_id) != SQLITE_OK) {
+        sqlite3_finalize(stmt);
+        return false;
+    }
+
+    sqlite3_int64 shown = 0, skipped = 0, correct = 0;
+    histogram_t hist = {0};
+    const int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        shown = sqlite3_column_int64(stmt, 0);
+        skipped = sqlite3_column_int64(stmt, 1);
+        correct = sqlite3_column_int64(stmt, 2);
+        hist_load(&hist, sqlite3_column_blob(stmt, 3), (size_t)sqlite3_column_bytes(stmt, 3));
+    }
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+        return false;
+    }
+
+    shown += 1;
+    skipped += answer->outcome == ANSWER_SKIPPED;
+    correct += answer->outcome == ANSWER_CORRECT;
+    if (answer->outcome != ANSWER_SKIPPED) {
+        hist_record(&hist, answer->latency_ms);
+    }
+    uint8_t blob[HIST_BLOB];
+    const size_t size = hist_save(&hist, blob);
+
+    const char *saveQUERY = "INSERT OR REPLACE INTO question_stats (category, question_id, shown, skipped, correct, histogram) "
+                            "VALUES (?, ?, ?, ?, ?, ?);";
+    const bool ret = sqlite3_prepare_v3(db, saveQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) == SQLITE_OK &&
+                     sqlite3_bind_text(stmt, 1, category, NULL_BYTE, SQLITE_TRANSIENT) == SQLITE_OK &&
+                     sqlite3_bind_int(stmt, 2, answer->question_id) == SQLITE_OK &&
+                     sqlite3_bind_int64(stmt, 3, shown) == SQLITE_OK &&
+                     sqlite3_bind_int64(stmt, 4, skipped) == SQLITE_OK &&
+                     sqlite3_bind_int64(stmt, 5, correct) == SQLITE_OK &&
+                     sqlite3_bind_blob(stmt, 6, blob, (int)size, SQLITE_TRANSIENT) == SQLITE_OK &&
+                     sqlite3_step(stmt) == SQLITE_DONE;
+    sqlite3_finalize(stmt);
+    return ret;
+}
+
+/**
+ * @brief This function reads the questions a player has seen lately in a category.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param playerId A pointer to the id of the player.
+ * @param category A pointer to the category of the questions.
+ * @param seen A pointer to the set receiving the ids of the questions, empty if the player saw none.
+ *
+ * @returns true if the set is read, otherwise false.
+ */
+bool retrieve_seen_questions(sqlite3 *db, const char *playerId, const char *category, seen_t *seen) {
+    seen_clear(seen);
+
+    sqlite3_stmt *stmt = NULL;
+    const char *sqlQUERY = "SELECT seen FROM seen_questions WHERE player_id = ? AND category = ?;";
+    if (sqlite3_prepare_v3(db, sqlQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK ||
+        sqlite3_bind_text(stmt, 1, playerId, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK ||
+        sqlite3_bind_text(stmt, 2, category, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return false;
+    }
+
+    const int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW &&
+        !seen_load(seen, sqlite3_column_blob(stmt, 0), (size_t)sqlite3_column_bytes(stmt, 0))) {
+        log_error(__func__, __FILE__, __LINE__, "Invalid seen questions of %s, they are ignored!...\n", playerId);
+    }
+    sqlite3_finalize(stmt);
+    return rc == SQLITE_ROW || rc == SQLITE_DONE;
+}
+
+
+/**
+ * @brief This function adds the questions of a game to the ones the player has seen in its category.
+ *        The sampler may skip half of the ids of the category at most, so the set keeps as many.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param playerId A pointer to the id of the player.
+ * @param result A pointer to the result of the game.
+ *
+ * @returns true if the set is saved, otherwise false.
+ */
+static bool update_seen_questions(sqlite3 *db, const char *playerId, const gresult_t *result) {
+    char sqlQUERY[MAX_BUFF];
+    snprintf(sqlQUERY, sizeof(sqlQUERY), "SELECT max(question_id) - min(question_id) + 1 FROM %s;", result->category);
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v3(db, sqlQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK ||
+        sqlite3_step(stmt) != SQLITE_ROW) {
+        sqlite3_finalize(stmt);
+        return false;
+    }
+    const sqlite3_int64 range = sqlite3_column_int64(stmt, 0);
+    sqlite3_finalize(stmt);
+    const uint32_t limit = range / 2 < SEEN_MAX ? (uint32_t)(range / 2) : SEEN_MAX;
+
+    seen_t *seen = malloc(sizeof(seen_t));
+    if (seen == NULL) {
+        log_error(__func__, __FILE__, __LINE__, "malloc() : %s\n", strerror(ENOMEM));
+        return false;
+    }
+    bool ret = retrieve_seen_questions(db, playerId, result->category, seen);
+    for (size_t i = 0; ret && i < result->count; i++) {
+        seen_add(seen, (uint32_t)result->answers[i].question_id, limit);
+    }
+
+    uint8_t blob[SEEN_BLOB];
+    const size_t size = ret ? seen_save(seen, blob, sizeof(blob)) : 0;
+    free(seen);
+
+    const char *saveQUERY = "INSERT OR REPLACE INTO seen_questions (player_id, category, seen) VALUES (?, ?, ?);";
+    ret = size > 0 &&
+          sqlite3_prepare_v3(db, saveQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) == SQLITE_OK &&
+          sqlite3_bind_text(stmt, 1, playerId, NULL_BYTE, SQLITE_TRANSIENT) == SQLITE_OK &&
+          sqlite3_bind_text(stmt, 2, result->category, NULL_BYTE, SQLITE_TRANSIENT) == SQLITE_OK &&
+          sqlite3_bind_blob(stmt, 3, blob, (int)size, SQLITE_TRANSIENT) == SQLITE_OK &&
+          sqlite3_step(stmt) == SQLITE_DONE;
+    sqlite3_finalize(stmt);
+    return ret;
+}
+
+/**
+ * @brief This function saves the result of a game in the 'games' table, & the time taken on each of its questions
+ *        in the 'answers' table, in one transaction so a game is never saved without its answers.
+ *
+ * @param player A pointer to the player stats structure of the player who played the game.
+ * @param result A pointer to the result of the game.
+ *
+ * @returns true if the result is saved, otherwise false.
+ */
+bool insert_game_result(const pstats_t *player, const gresult_t *result) {
+    sqlite3 *db = NULL;
+    if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READWRITE, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to open database : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return false;
+    }
+    if (sqlite3_exec(db, "BEGIN;", NO_CALLBACK, NO_ERR_MSSG, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to begin transaction : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return false;
+    }
+
+    const char *gameQUERY = "INSERT INTO games (player_id, category, score, bonus, skipped, questions, duration_ms, "
+                            "answering_ms) VALUES (?, ?, ?, ?, ?, ?, ?, ?);";
+    sqlite3_stmt *stmt = NULL;
+    bool ret = sqlite3_prepare_v3(db, gameQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) == SQLITE_OK &&
+               sqlite3_bind_text(stmt, 1, player->profile.playerId, NULL_BYTE, SQLITE_TRANSIENT) == SQLITE_OK &&
+               sqlite3_bind_text(stmt, 2, result->category, NULL_BYTE, SQLITE_TRANSIENT) == SQLITE_OK &&
+               sqlite3_bind_int(stmt, 3, (int)result->score) == SQLITE_OK &&
+               sqlite3_bind_int(stmt, 4, (int)result->bonus) == SQLITE_OK &&
+               sqlite3_bind_int(stmt, 5, (int)result->skipped) == SQLITE_OK &&
+               sqlite3_bind_int(stmt, 6, (int)result->count) == SQLITE_OK &&
+               sqlite3_bind_int64(stmt, 7, timing_ms(result->timing->elapsed)) == SQLITE_OK &&
+               sqlite3_bind_int64(stmt, 8, timing_ms(result->timing->answering)) == SQLITE_OK &&
+               sqlite3_step(stmt) == SQLITE_DONE;
+    sqlite3_finalize(stmt);
+    stmt = NULL;
+
+    //? One statement is reset & bound again for every answer
+    const sqlite3_int64 gameId = sqlite3_last_insert_rowid(db);
+    const char *answerQUERY = "INSERT INTO answers (game_id, category, question_id, outcome, latency_ms) VALUES (?, ?, ?, ?, ?);";
+    ret = ret && sqlite3_prepare_v3(db, answerQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) == SQLITE_OK;
+
+    for (size_t i = 0; ret && i < result->count; i++) {
+        const answer_t *answer = &result->answers[i];
+        ret = sqlite3_bind_int64(stmt, 1, gameId) == SQLITE_OK &&
+              sqlite3_bind_text(stmt, 2, result->category, NULL_BYTE, SQLITE_STATIC) == SQLITE_OK &&
+              sqlite3_bind_int(stmt, 3, answer->question_id) == SQLITE_OK &&
+              sqlite3_bind_int(stmt, 4, (int)answer->outcome) == SQLITE_OK &&
+              sqlite3_bind_int64(stmt, 5, answer->latency_ms) == SQLITE_OK &&
+              sqlite3_step(stmt) == SQLITE_DONE &&
+              sqlite3_reset(stmt) == SQLITE_OK;
+    }
+    sqlite3_finalize(stmt);
+
+    //? The histograms are updated with the answers of the game only, never recomputed from the 'answers' table
+    histogram_t game = {0};
+    for (size_t i = 0; ret && i < result->count; i++) {
+        if (result->answers[i].outcome != ANSWER_SKIPPED) {
+            hist_record(&game, result->answers[i].latency_ms);
+        }
+        ret = update_question_stats(db, result->category, &result->answers[i]);
+    }
+    ret = ret && update_player_latency(db, player->profile.playerId, &game);
+    ret = ret && update_seen_questions(db, player->profile.playerId, result);
+
+    if (!ret) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to save the game result : %s!...\n", sqlite3_errmsg(db));
+    }
+    if (sqlite3_exec(db, ret ? "COMMIT;" : "ROLLBACK;", NO_CALLBACK, NO_ERR_MSSG, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to end transaction : %s!...\n", sqlite3_errmsg(db));
+        ret = false;
+    }
+    sqlite3_close(db);
+    return ret;
+}
+
+
+/**
+ * @brief This function deletes the results of every game of a player, with the time taken on their questions
+ *        & the questions they have seen. The answers of the player stay counted in the histograms of the questions.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param playerId A pointer to the id of the player.
+ *
+ * @returns true if the results are deleted, otherwise false.
+ */
+bool delete_game_results(sqlite3 *db, const char *playerId) {
+    const char *sqlQUERY[] = {
+        "DELETE FROM answers WHERE game_id IN (SELECT game_id FROM games WHERE player_id = ?);",
+        "DELETE FROM games WHERE player_id = ?;",
+        "DELETE FROM player_latency WHERE player_id = ?;",
+        "DELETE FROM seen_questions WHERE player_id = ?;"
+    };
+
+    for (size_t i = 0; i < sizeof(sqlQUERY) / sizeof(sqlQUERY[0]); i++) {
+        sqlite3_stmt *stmt = NULL;
+        if (sqlite3_prepare_v3(db, sqlQUERY[i], NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK) {
+            log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+            return false;
+        }
+        if (sqlite3_bind_text(stmt, 1, playerId, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK ||
+            sqlite3_step(stmt) != SQLITE_DONE) {
+            log_error(__func__, __FILE__, __LINE__, "Failed to delete game results : %s!...\n", sqlite3_errmsg(db));
+            sqlite3_finalize(stmt);
+            return false;
+        }
+        sqlite3_finalize(stmt);
+    }
+    return true;
+}
+
 /**
  * @brief This function clears/resets all the player stats in the 'players' table
  *
@@ -787,7 +1345,8 @@ bool reset_badges_table(sqlite3 *db, const char *uname) {
 bool setup(void) {
     if (access(DBFILEPATH, F_OK) == 0) {
         print(" [%s] Database already exists.\n", SUCCESS_EMOJI);
-        return true;
+        //? The tables are created if not exists, so the ones added since the database was created are added to it
+        return create_new_database();
     }
 
     if (!create_new_database()) {
@@ -5,202 +5,202 @@ static const quiz_t science[] = {
     {
         .question = "Which of the following is the smallest unit of matter?",
         .choices = {
-            "[A]. Atom",
-            "[B]. Molecule",
-            "[C]. Neutron",
-            "[D]. Proton"
+            "Atom",
+            "Molecule",
+            "Neutron",
+            "Proton"
         },
-        .correct_choice = "[A]. Atom"
+        .correct = 0
     },
     {
         .question = "What is the chemical symbol for the element gold?",
         .choices = {
-            "[A]. Ag",
-            "[B]. Fe",
-            "[C]. Au",
-            "[D]. Hg"
+            "Ag",
+            "Fe",
+            "Au",
+            "Hg"
         },
-        .correct_choice = "[C]. Au"
+        .correct = 2
     },
     {
         .question = "Which gas is most abundant in the Earth's atmosphere?",
         .choices = {
-            "[A]. Oxygen",
-            "[B]. Carbon dioxide",
-            "[C]. Nitrogen",
-            "[D]. Hydrogen"
+            "Oxygen",
+            "Carbon dioxide",
+            "Nitrogen",
+            "Hydrogen"
         },
-        .correct_choice = "[C]. Nitrogen"
+        .correct = 2
     },
     {
         .question = "What's the process by which plants synthesize their food?",
         .choices = {
-            "[A]. Respiration",
-            "[B]. Photosynthesis",
-            "[C]. Osmosis",
-            "[D]. Reverse Osmosis"
+            "Respiration",
+            "Photosynthesis",
+            "Osmosis",
+            "Reverse Osmosis"
         },
-        .correct_choice = "[B]. Photosynthesis"
+        .correct = 1
     },
     {
         .question = "Which organelle produces energy in a cell?",
         .choices = {
-            "[A]. Nucleus",
-            "[B]. Endoplasmic reticulum",
-            "[C]. Golgi apparatus",
-            "[D]. Mitochondria"
+            "Nucleus",
+            "Endoplasmic reticulum",
+            "Golgi apparatus",
+            "Mitochondria"
         },
-        .correct_choice = "[D]. Mitochondria"
+        .correct = 3
     },
     {
         .question = "What is the chemical formula for water?",
         .choices = {
-            "[A]. H2O",
-            "[B]. CO2",
-            "[C]. O2",
-            "[D]. NaCl"
+            "H2O",
+            "CO2",
+            "O2",
+            "NaCl"
         },
-        .correct_choice = "[A]. H2O"
+        .correct = 0
     },
     {
         .question = "Which planet is known as the 'Red Planet'?",
         .choices = {
-            "[A]. Venus",
-            "[B]. Earth",
-            "[C]. Mars",
-            "[D]. Jupiter"
+            "Venus",
+            "Earth",
+            "Mars",
+            "Jupiter"
         },
-        .correct_choice = "[C]. Mars"
+        .correct = 2
     },
     {
         .question = "What is the smallest bone in the human body?",
         .choices = {
-            "[A]. Femur",
-            "[B]. Tibia",
-            "[C]. Stapes",
-            "[D]. Radius"
+            "Femur",
+            "Tibia",
+            "Stapes",
+            "Radius"
         },
-        .correct_choice = "[C]. Stapes"
+        .correct = 2
     },
     {
         .question = "Which force keeps planets in orbit around the Sun?",
         .choices = {
-            "[A]. Gravitational force",
-            "[B]. Magnetic force",
-            "[C]. Electric force",
-            "[D]. Centrifugal force"
+            "Gravitational force",
+            "Magnetic force",
+            "Electric force",
+            "Centrifugal force"
         },
-        .correct_choice = "[A]. Gravitational force"
+        .correct = 0
     },
     {
         .question = "What is the chemical symbol for helium?",
         .choices = {
-            "[A]. He",
-            "[B]. H",
-            "[C]. Ne",
-            "[D]. Li"
+            "He",
+            "H",
+            "Ne",
+            "Li"
         },
-        .correct_choice = "[A]. He"
+        .correct = 0
     },
     {
         .question = "The hotter the _____ the faster the rate of evaporation.",
         .choices = {
-            "[A]. Water",
-            "[B]. Air",
-            "[C]. Temperature",
-            "[D]. Soil"
+            "Water",
+            "Air",
+            "Temperature",
+            "Soil"
         },
-        .correct_choice = "[C]. Temperature"
+        .correct = 2
     },
     {
         .question = "How many significant digits are there in 0.0076003?",
         .choices = {
-            "[A]. 5 significant figures",
-            "[B]. 8 significant figures",
-            "[C]. 3 significant figures",
-            "[D]. 7 significant figures"
+            "5 significant figures",
+            "8 significant figures",
+            "3 significant figures",
+            "7 significant figures"
         },
-        .correct_choice = "[A]. 5 significant figures"
+        .correct = 0
     },
     {
         .question = "What is the hardest naturally occurring substance on Earth?",
         .choices = {
-            "[A]. Quartz",
-            "[B]. Diamond",
-            "[C]. Topaz",
-            "[D]. Corundum"
+            "Quartz",
+            "Diamond",
+            "Topaz",
+            "Corundum"
         },
-        .correct_choice = "[B]. Diamond"
+        .correct = 1
     },
     {
         .question = "Which layer of atmosphere contains the ozone layer",
         .choices = {
-            "[A]. Stratosphere",
-            "[B]. Mesosphere",
-            "[C]. Thermosphere",
-            "[D]. Exosphere"
+            "Stratosphere",
+            "Mesosphere",
+            "Thermosphere",
+            "Exosphere"
         },
-        .correct_choice = "[A]. Stratosphere"
+        .correct = 0
     },
     {
         .question = "Which of the following is a fossil fuel?",
         .choices = {
-            "[A]. Coal",
-            "[B]. Natural gas",
-            "[C]. Oil",
-            "[D]. All of the above"
+            "Coal",
+            "Natural gas",
+            "Oil",
+            "All of the above"
         },
-        .correct_choice = "[D]. All of the above"
+        .correct = 3
     },
     {
         .question = "The appendix is attached to which part of human body?",
         .choices = {
-            "[A]. Stomach",
-            "[B]. Small intestine",
-            "[C]. Gall bladder",
-            "[D]. Large intestine"
+            "Stomach",
+            "Small intestine",
+            "Gall bladder",
+            "Large intestine"
         },
-        .correct_choice = "[D]. Large intestine"
+        .correct = 3
     },
     {
         .question = "Which of the following is a type of renewable energy?",
         .choices = {
-            "[A]. Solar energy",
-            "[B]. Wind energy",
-            "[C]. Hydropower",
-            "[D]. All of the above"
+            "Solar energy",
+            "Wind energy",
+            "Hydropower",
+            "All of the above"
         },
-        .correct_choice = "[D]. All of the above"
+        .correct = 3
     },
     {
         .question = "What is the name of the process by which cells divide?",
         .choices = {
-            "[A]. Mitosis",
-            "[B]. Meiosis",
-            "[C]. Both A and B",
-            "[D]. None of the above"
+            "Mitosis",
+            "Meiosis",
+            "Both A and B",
+            "None of the above"
         },
-        .correct_choice = "[A]. Mitosis"
+        .correct = 0
     },
     {
         .question = "Which part of the brain controls respiration?",
         .choices = {
-            "[A]. Medulla oblongata",
-            "[B]. Cerebellum",
-            "[C]. Cerebral cortex",
-            "[D]. Cerebrum"
+            "Medulla oblongata",
+            "Cerebellum",
+            "Cerebral cortex",
+            "Cerebrum"
         },
-        .correct_choice = "[A]. Medulla oblongata"
+        .correct = 0
     },
     {
         .question = "A surge of which hormone stimulates ovulation in females?",
         .choices = {
-            "[A]. Luteinizing hormone",
-            "[B]. Estrogen",
-            "[C]. Follicle stimulating hormone",
-            "[D]. Progesterone"
+            "Luteinizing hormone",
+            "Estrogen",
+            "Follicle stimulating hormone",
+            "Progesterone"
         },
-        .correct_choice = "[A]. Luteinizing hormone"
+        .correct = 0
     }
 };
 
@@ -210,202 +210,202 @@ static const quiz_t sports[] = {
     {
         .question = "Who won the FIFA World Cup in 2018?",
         .choices = {
-            "[A]. Brazil",
-            "[B]. Germany",
-            "[C]. France",
-            "[D]. Argentina"
+            "Brazil",
+            "Germany",
+            "France",
+            "Argentina"
         },
-        .correct_choice = "[C]. France"
+        .correct = 2
     },
     {
         .question = "Which basketball player is often called 'The King'?",
         .choices = {
-            "[A]. Kobe Bryant",
-            "[B]. Michael Jordan",
-            "[C]. LeBron James",
-            "[D]. Shaquille O'Neal"
+            "Kobe Bryant",
+            "Michael Jordan",
+            "LeBron James",
+            "Shaquille O'Neal"
         },
-        .correct_choice = "[C]. LeBron James"
+        .correct = 2
     },
     {
         .question = "Which martial art emphasizes throws & grappling techniques?",
         .choices = {
-            "[A]. Karate",
-            "[B]. Taekwondo",
-            "[C]. Judo",
-            "[D]. Muay Thai"
+            "Karate",
+            "Taekwondo",
+            "Judo",
+            "Muay Thai"
         },
-        .correct_choice = "[C]. Judo"
+        .correct = 2
     },
     {//"Which country dominates men's tennis with Nadal and Verdasco?"
         .question = "What is the technical term for a 40-40 score in tennis?",
         .choices = {
-            "[A]. Rally",
-            "[B]. Deuce",
-            "[C]. Overhead",
-            "[D]. Deuce court"
+            "Rally",
+            "Deuce",
+            "Overhead",
+            "Deuce court"
         },
-        .correct_choice = "[B]. Deuce"
+        .correct = 1
     },
     {
         .question = "Which football/football team is known as the 'Red Devils'?",
         .choices = {
-            "[A]. Real Madrid",
-            "[B]. Manchester United",
-            "[C]. Bayern Munich",
-            "[D]. Liverpool"
+            "Real Madrid",
+            "Manchester United",
+            "Bayern Munich",
+            "Liverpool"
         },
-        .correct_choice = "[B]. Manchester United"
+        .correct = 1
     },
     {
         .question = "Which NBA team was famous for 'Showtime' in the 1980s?",
         .choices = {
-            "[A]. Boston Celtics",
-            "[B]. Los Angeles Lakers",
-            "[C]. Chicago Bulls",
-            "[D]. Miami Heat"
+            "Boston Celtics",
+            "Los Angeles Lakers",
+            "Chicago Bulls",
+            "Miami Heat"
         },
-        .correct_choice = "[B]. Los Angeles Lakers"
+        .correct = 1
     },
     {
         .question = "What martial art is known as the 'Art of Eight Limbs'?",
         .choices = {
-            "[A]. Karate",
-            "[B]. Jiu-Jitsu",
-            "[C]. Muay Thai",
-            "[D]. Taekwondo"
+            "Karate",
+            "Jiu-Jitsu",
+            "Muay Thai",
+            "Taekwondo"
         },
-        .correct_choice = "[C]. Muay Thai"
+        .correct = 2
     },
     {
         .question = "Which football player is often referred to as 'CR7'?",
         .choices = {
-            "[A]. Cristiano Ronaldo",
-            "[B]. Lionel Messi",
-            "[C]. Neymar",
-            "[D]. Gareth Bale"
+            "Cristiano Ronaldo",
+            "Lionel Messi",
+            "Neymar",
+            "Gareth Bale"
         },
-        .correct_choice = "[A]. Cristiano Ronaldo"
+        .correct = 0
     },
     {
         .question = "How many points is a three-point field goal in basketball?",
         .choices = {
-            "[A]. 1",
-            "[B]. 2",
-            "[C]. 3",
-            "[D]. 4"
+            "1",
+            "2",
+            "3",
+            "4"
         },
-        .correct_choice = "[C]. 3"
+        .correct = 2
     },
     {
         .question = "Which of the following martial art originated in South Korea?",
         .choices = {
-            "[A]. Karate",
-            "[B]. Judo",
-            "[C]. Taekwondo",
-            "[D]. Kung Fu"
+            "Karate",
+            "Judo",
+            "Taekwondo",
+            "Kung Fu"
         },
-        .correct_choice = "[C]. Taekwondo"
+        .correct = 2
     },
     {
         .question = "Which team has won the most FIFA World Cups?",
         .choices = {
-            "[A]. Brazil",
-            "[B]. Germany",
-            "[C]. Italy",
-            "[D]. Argentina"
+            "Brazil",
+            "Germany",
+            "Italy",
+            "Argentina"
         },
-        .correct_choice = "[A]. Brazil"
+        .correct = 0
     },
     {
         .question = "Which of the following NBA players has the highest points?",
         .choices = {
-            "[A]. LeBron James",
-            "[B]. Kareem Abdul-Jabbar",
-            "[C]. Michael Jordan",
-            "[D]. Wilt Chamberlain"
+            "LeBron James",
+            "Kareem Abdul-Jabbar",
+            "Michael Jordan",
+            "Wilt Chamberlain"
         },
-        .correct_choice = "[A]. LeBron James"
+        .correct = 0
     },
     {
         .question = "Who holds the record for the fastest 100m sprint in history?",
         .choices = {
-            "[A]. Justin Gatlin",
-            "[B]. Asafa Powell",
-            "[C]. Usain Bolt",
-            "[D]. Carl Lewis"
+            "Justin Gatlin",
+            "Asafa Powell",
+            "Usain Bolt",
+            "Carl Lewis"
         },
-        .correct_choice = "[C]. Usain Bolt"
+        .correct = 2
     },
     {
         .question = "Which player scored the fastest hat-trick in Premier League?",
         .choices = {
-            "[A]. Jebron Lames",
-            "[B]. Gareth Bale",
-            "[C]. Sadio Mane",
-            "[D]. Cristiano Ronaldo"
+            "Jebron Lames",
+            "Gareth Bale",
+            "Sadio Mane",
+            "Cristiano Ronaldo"
         },
-        .correct_choice = "[C]. Sadio Mane"
+        .correct = 2
     },
     {
         .question = "Which NBA team has made the most appearances in the finals?",
         .choices = {
-            "[A]. Los Angeles Lakers",
-            "[B]. Toronto Raptors",
-            "[C]. Boston Celtics",
-            "[D]. Chicago Bulls"
+            "Los Angeles Lakers",
+            "Toronto Raptors",
+            "Boston Celtics",
+            "Chicago Bulls"
         },
-        .correct_choice = "[A]. Los Angeles Lakers"
+        .correct = 0
     },
     {
         .question = "What martial art is a traditional sword martial art?",
         .choices = {
-            "[A] Karate",
-            "[B] Taekwondo",
-            "[C] Muay Thai",
-            "[D] Headong kumdo"
+            "Karate",
+            "Taekwondo",
+            "Muay Thai",
+            "Headong kumdo"
         },
-        .correct_choice = "[D] Headong kumdo"
+        .correct = 3
     },
     {
         .question = "As of 2023, which player has won the most Ballon d'Or awards?",
         .choices = {
-            "[A] Lionel Messi",
-            "[B] Cristiano Ronaldo",
-            "[C] Johan Cruyff",
-            "[D] Michel Platini"
+            "Lionel Messi",
+            "Cristiano Ronaldo",
+            "Johan Cruyff",
+            "Michel Platini"
         },
-        .correct_choice = "[A] Lionel Messi"
+        .correct = 0
     },
     {
         .question = "Which basketball team has won the most NBA championships?",
         .choices = {
-            "[A] Boston Celtics",
-            "[B] Los Angeles Lakers",
-            "[C] Golden State Warriors",
-            "[D] Chicago Bulls"
+            "Boston Celtics",
+            "Los Angeles Lakers",
+            "Golden State Warriors",
+            "Chicago Bulls"
         },
-        .correct_choice = "[B] Boston Celtics"
+        .correct = 0
     },
     {
         .question = "Who is the founder of the 'Wadō-ryū' martial arts?",
         .choices = {
-            "[A] Keigo Abe",
-            "[B] Satoshi Nakamoto",
-            "[C] Hironori Ōtsuka",
-            "[D] William Kwai-sun Chow"
+            "Keigo Abe",
+            "Satoshi Nakamoto",
+            "Hironori Ōtsuka",
+            "William Kwai-sun Chow"
         },
-        .correct_choice = "[C] Hironori Ōtsuka"
+        .correct = 2
     },
     {
         .question = "Which of the following tournaments is held every four years?",
         .choices = {
-            "[A] FIFA World Cup",
-            "[B] UEFA European Championship",
-            "[C] Copa América",
-            "[D] UEFA Champions League"
+            "FIFA World Cup",
+            "UEFA European Championship",
+            "Copa América",
+            "UEFA Champions League"
         },
-        .correct_choice = "[A] FIFA World Cup"
+        .correct = 0
     }
 };
 
@@ -415,202 +415,202 @@ static const quiz_t general_knowledge[] = {
     {
         .question = "What is the largest planet in our solar system?",
         .choices = {
-            "[A]. Venus",
-            "[B]. Earth",
-            "[C]. Jupiter",
-            "[D]. Mars"
+            "Venus",
+            "Earth",
+            "Jupiter",
+            "Mars"
         },
-        .correct_choice = "[C]. Jupiter"
+        .correct = 2
     },
     {
         .question = "Which river is the longest in the world?",
         .choices = {
-            "[A]. Amazon River",
-            "[B]. Nile River",
-            "[C]. Mississippi River",
-            "[D]. Yangtze River"
+            "Amazon River",
+            "Nile River",
+            "Mississippi River",
+            "Yangtze River"
         },
-        .correct_choice = "[B]. Nile River"
+        .correct = 1
     },
     {
         .question = "Who is the author of 'To Kill a Mockingbird'?",
         .choices = {
-            "[A]. J.K. Rowling",
-            "[B]. Harper Lee",
-            "[C]. George Orwell",
-            "[D]. Charles Dickens"
+            "J.K. Rowling",
+            "Harper Lee",
+            "George Orwell",
+            "Charles Dickens"
         },
-        .correct_choice = "[B]. Harper Lee"
+        .correct = 1
     },
     {
         .question = "Which country is known as the Land of the Rising Sun?",
         .choices = {
-            "[A]. China",
-            "[B]. Japan",
-            "[C]. India",
-            "[D]. South Korea"
+            "China",
+            "Japan",
+            "India",
+            "South Korea"
         },
-        .correct_choice = "[B]. Japan"
+        .correct = 1
     },
     {
         .question = "What is the largest ocean on Earth?",
         .choices = {
-            "[A]. Atlantic Ocean",
-            "[B]. Indian Ocean",
-            "[C]. Arctic Ocean",
-            "[D]. Pacific Ocean"
+            "Atlantic Ocean",
+            "Indian Ocean",
+            "Arctic Ocean",
+            "Pacific Ocean"
         },
-        .correct_choice = "[D]. Pacific Ocean"
+        .correct = 3
     },
     {
         .question = "Who painted the Mona Lisa?",
         .choices = {
-            "[A]. Vincent van Gogh",
-            "[B]. Pablo Picasso",
-            "[C]. Leonardo da Vinci",
-            "[D]. Michelangelo"
+            "Vincent van Gogh",
+            "Pablo Picasso",
+            "Leonardo da Vinci",
+            "Michelangelo"
         },
-        .correct_choice = "[C]. Leonardo da Vinci"
+        .correct = 2
     },
     {
         .question = "What is the currency of Mexico?",
         .choices = {
-            "[A]. Peso",
-            "[B]. Euro",
-            "[C]. Dollar",
-            "[D]. Yen"
+            "Peso",
+            "Euro",
+            "Dollar",
+            "Yen"
         },
-        .correct_choice = "[A]. Peso"
+        .correct = 0
     },
     {
         .question = "Which among the following is known as the City of Love?",
         .choices = {
-            "[A]. Abuja",
-            "[B]. Paris",
-            "[C]. Barcelona",
-            "[D]. Istanbul"
+            "Abuja",
+            "Paris",
+            "Barcelona",
+            "Istanbul"
         },
-        .correct_choice = "[B]. Paris"
+        .correct = 1
     },
     {
         .question = "In which year did the Titanic sink?",
         .choices = {
-            "[A]. 1907",
-            "[B]. 1912",
-            "[C]. 1920",
-            "[D]. 1931"
+            "1907",
+            "1912",
+            "1920",
+            "1931"
         },
-        .correct_choice = "[B]. 1912"
+        .correct = 1
     },
     {
         .question = "Who was the first woman to fly solo across the Atlantic?",
         .choices = {
-            "[A]. Amelia Earhart",
-            "[B]. Bessie Coleman",
-            "[C]. Charles Lindbergh",
-            "[D]. Howard Hughes"
+            "Amelia Earhart",
+            "Bessie Coleman",
+            "Charles Lindbergh",
+            "Howard Hughes"
         },
-        .correct_choice = "[A]. Amelia Earhart"
+        .correct = 0
     },
     {
         .question = "What is the capital of France?",
         .choices = {
-            "[A]. London",
-            "[B]. Berlin",
-            "[C]. Paris",
-            "[D]. Rome"
+            "London",
+            "Berlin",
+            "Paris",
+            "Rome"
         },
-        .correct_choice = "[C]. Paris"
+        .correct = 2
     },
     {
         .question = "What is the largest ocean in the world?",
         .choices = {
-            "[A]. Atlantic Ocean",
-            "[B]. Pacific Ocean",
-            "[C]. Indian Ocean",
-            "[D]. Arctic Ocean"
+            "Atlantic Ocean",
+            "Pacific Ocean",
+            "Indian Ocean",
+            "Arctic Ocean"
         },
-        .correct_choice = "[B]. Pacific Ocean"
+        .correct = 1
     },
     {
         .question = "What is the most populous country in the world?",
         .choices = {
-            "[A]. China",
-            "[B]. India",
-            "[C]. United States",
-            "[D]. Indonesia"
+            "China",
+            "India",
+            "United States",
+            "Indonesia"
         },
-        .correct_choice = "[A]. China"
+        .correct = 0
     },
     {
         .question = "What is the name of the world's tallest mountain?",
         .choices = {
-            "[A]. Mount Everest",
-            "[B]. K2",
-            "[C]. Kangchenjunga",
-            "[D]. Lhotse"
+            "Mount Everest",
+            "K2",
+            "Kangchenjunga",
+            "Lhotse"
         },
-        .correct_choice = "[A]. Mount Everest"
+        .correct = 0
     },
     {
         .question = "What is the name of the largest desert in the world?",
         .choices = {
-            "[A]. Sahara Desert",
-            "[B]. Arabian Desert",
-            "[C]. Gobi Desert",
-            "[D]. Arctic Desert"
+            "Sahara Desert",
+            "Arabian Desert",
+            "Gobi Desert",
+            "Arctic Desert"
         },
-        .correct_choice = "[A]. Sahara Desert"
+        .correct = 0
     },
     {
         .question = "What is the name of the most famous painting in the world?",
         .choices = {
-            "[A]. Mona Lisa",
-            "[B]. Starry Night",
-            "[C]. The Scream",
-            "[D]. Guernica"
+            "Mona Lisa",
+            "Starry Night",
+            "The Scream",
+            "Guernica"
         },
-        .correct_choice = "[A]. Mona Lisa"
+        .correct = 0
     },
     {
         .question = "what's the most famous book in the world as of 1995?",
         .choices = {
-            "[A]. The Bible",
-            "[B]. Quran",
-            "[C]. The Lord of the Rings",
-            "[D]. Harry Potter"
+            "The Bible",
+            "Quran",
+            "The Lord of the Rings",
+            "Harry Potter"
         },
-        .correct_choice = "[A]. The Bible"
+        .correct = 0
     },
     {
         .question = "What is the name of the longest river in the world?",
         .choices = {
-            "[A]. Nile River",
-            "[B]. Amazon River",
-            "[C]. Yangtze River",
-            "[D]. Mississippi River"
+            "Nile River",
+            "Amazon River",
+            "Yangtze River",
+            "Mississippi River"
         },
-        .correct_choice = "[A]. Nile River"
+        .correct = 0
     },
     {
         .question = "What's the most popular social media platform in the world?",
         .choices = {
-            "[A]. Facebook",
-            "[B]. Instagram",
-            "[C]. Twitter",
-            "[D]. TikTok"
+            "Facebook",
+            "Instagram",
+            "Twitter",
+            "TikTok"
         },
-        .correct_choice = "[A]. Facebook"
+        .correct = 0
     },
     {
         .question = "What is the name of the largest city in the world?",
         .choices = {
-            "[A]. Tokyo",
-            "[B]. Shanghai",
-            "[C]. Delhi",
-            "[D]. São Paulo"
+            "Tokyo",
+            "Shanghai",
+            "Delhi",
+            "São Paulo"
         },
-        .correct_choice = "[A]. Tokyo"
+        .correct = 0
     }
 };
 
@@ -633,7 +633,7 @@ bool insert_quiz_data(sqlite3 *db, const quiz_t *quizArray, const size_t arraySi
 
     char insertQUERY[MAX_BUFF * 2];
     snprintf(insertQUERY, sizeof(insertQUERY),
-             "INSERT INTO %s (question_id, question, choice_a, choice_b, choice_c, choice_d, correct_choice) "
+             "INSERT INTO %s (question_id, question, choice_a, choice_b, choice_c, choice_d, correct) "
              "VALUES (NULL, ?, ?, ?, ?, ?, ?)", tableName);
 
     sqlite3_stmt *stmt = NULL;
@@ -649,7 +649,7 @@ bool insert_quiz_data(sqlite3 *db, const quiz_t *quizArray, const size_t arraySi
             sqlite3_bind_text(stmt, 3, quizArray[i].choices[1], NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK ||
             sqlite3_bind_text(stmt, 4, quizArray[i].choices[2], NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK ||
             sqlite3_bind_text(stmt, 5, quizArray[i].choices[3], NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK ||
-            sqlite3_bind_text(stmt, 6, quizArray[i].correct_choice, NULL_BYTE, SQLITE_TRANSIENT) != SQLITE_OK) {
+            sqlite3_bind_int(stmt, 6, quizArray[i].correct) != SQLITE_OK) {
                 log_error(__func__, __FILE__, __LINE__, "Failed to bind values : %s!...\n", sqlite3_errmsg(db));
                 sqlite3_finalize(stmt);
                 return false;
@@ -0,0 +1,203 @@
+#include "../../include/db.h"
+
+// TODO : Struct for holding the stats of a question, as saved in the 'question_stats' table
+typedef struct QUESTION_STATS {
+    char        category[0x10];
+    int         question_id;
+    uint32_t    shown;
+    uint32_t    skipped;
+    uint32_t    correct;
+    uint32_t    p50;
+    uint32_t    p90;
+    uint32_t    answers;
+} questionstats_t;
+
+
+/**
+ * @returns The order of two questions from the slowest to answer (90th percentile) to the fastest
+ */
+static int compare_slowest(const void *a, const void *b) {
+    const questionstats_t *lhs = a, *rhs = b;
+    if (lhs->p90 != rhs->p90) {
+        return lhs->p90 < rhs->p90 ? 1 : -1;
+    }
+    return lhs->p50 < rhs->p50 ? 1 : lhs->p50 > rhs->p50 ? -1 : 0;
+}
+
+
+/**
+ * @returns The order of two questions from the most skipped (rate, then count) to the least
+ */
+static int compare_skipped(const void *a, const void *b) {
+    const questionstats_t *lhs = a, *rhs = b;
+    const uint64_t left = (uint64_t)lhs->skipped * rhs->shown, right = (uint64_t)rhs->skipped * lhs->shown;
+    if (left != right) {
+        return left < right ? 1 : -1;
+    }
+    return lhs->skipped < rhs->skipped ? 1 : lhs->skipped > rhs->skipped ? -1 : 0;
+}
+
+
+/**
+ * @brief This function reads the text of a question from the table of its category.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param stats A pointer to the stats of the question.
+ * @param question A pointer to the buffer receiving the text of the question.
+ * @param size The size of the buffer.
+ */
+static void get_question_text(sqlite3 *db, const questionstats_t *stats, char *question, const size_t size) {
+    const char *categorySet[] = {"SPORTS", "SCIENCE", "BASICS"};
+    snprintf(question, size, "?");
+
+    //? The category names a table, so only the known ones are put in the query
+    for (size_t i = 0; i < sizeof(categorySet) / sizeof(categorySet[0]); i++) {
+        if (strcasecmp(stats->category, categorySet[i]) != 0) {
+            continue;
+        }
+        char sqlQUERY[BUF_SIZE];
+        snprintf(sqlQUERY, sizeof(sqlQUERY), "SELECT question FROM %s WHERE question_id = ?;", categorySet[i]);
+
+        sqlite3_stmt *stmt = NULL;
+        if (sqlite3_prepare_v3(db, sqlQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) == SQLITE_OK &&
+            sqlite3_bind_int(stmt, 1, stats->question_id) == SQLITE_OK &&
+            sqlite3_step(stmt) == SQLITE_ROW) {
+            snprintf(question, size, "%s", (const char *)sqlite3_column_text(stmt, 0));
+        }
+        sqlite3_finalize(stmt);
+        return;
+    }
+}
+
+
+/**
+ * @brief This function reads the stats of every question, & merges their answer times into a single histogram.
+ *
+ * @param db A pointer to the SQLite database connection.
+ * @param count A pointer to the number of questions read.
+ * @param overall A pointer to the histogram receiving the answer times of every question.
+ *
+ * @returns A pointer to the stats read (to be freed), or NULL on error.
+ */
+static questionstats_t *retrieve_question_stats(sqlite3 *db, size_t *count, histogram_t *overall) {
+    sqlite3_stmt *stmt = NULL;
+    const char *sqlQUERY = "SELECT category, question_id, shown, skipped, correct, histogram FROM question_stats;";
+    if (sqlite3_prepare_v3(db, sqlQUERY, NULL_BYTE, NO_PREP_FLAG, &stmt, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to prepare statement : %s!...\n", sqlite3_errmsg(db));
+        return NULL;
+    }
+
+    size_t capacity = 0x40;
+    questionstats_t *stats = malloc(capacity * sizeof(questionstats_t));
+    *count = 0;
+    memset(overall, 0, sizeof(*overall));
+
+    int rc = SQLITE_DONE;
+    while (stats != NULL && (rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (*count == capacity) {
+            questionstats_t *grown = realloc(stats, 2 * capacity * sizeof(questionstats_t));
+            if (grown == NULL) {
+                free(stats);
+                stats = NULL;
+                break;
+            }
+            stats = grown;
+            capacity *= 2;
+        }
+
+        histogram_t hist;
+        hist_load(&hist, sqlite3_column_blob(stmt, 5), (size_t)sqlite3_column_bytes(stmt, 5));
+        hist_merge(overall, &hist);
+
+        questionstats_t *row = &stats[(*count)++];
+        snprintf(row->category, sizeof(row->category), "%s", (const char *)sqlite3_column_text(stmt, 0));
+        row->question_id = sqlite3_column_int(stmt, 1);
+        row->shown = (uint32_t)sqlite3_column_int64(stmt, 2);
+        row->skipped = (uint32_t)sqlite3_column_int64(stmt, 3);
+        row->correct = (uint32_t)sqlite3_column_int64(stmt, 4);
+        row->answers = hist.count;
+        row->p50 = hist_percentile(&hist, 0.50);
+        row->p90 = hist_percentile(&hist, 0.90);
+    }
+
+    if (stats == NULL) {
+        log_error(__func__, __FILE__, __LINE__, "malloc() : %s\n", strerror(ENOMEM));
+    }
+    else if (rc != SQLITE_DONE) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to read the 'question_stats' table : %s!...\n", sqlite3_errmsg(db));
+        free(stats);
+        stats = NULL;
+    }
+    sqlite3_finalize(stmt);
+    return stats;
+}
+
+
+/**
+ * @brief This function prints the report of the questions to the admin, without the terminal UI (ie: ./main --report).
+ *        It lists the questions that take the longest to answer & the ones skipped the most,
+ *        from the histograms of the answer times saved after every game.
+ *
+ * @param stream A pointer to the stream the report is printed to.
+ * @param limit The number of questions listed in each section.
+ *
+ * @returns true if the report is printed, otherwise false.
+ */
+bool print_question_report(FILE *stream, const size_t limit) {
+    sqlite3 *db = NULL;
+    if (sqlite3_open_v2(DBFILEPATH, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Error opening db : %s!...\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return false;
+    }
+
+    size_t count = 0;
+    histogram_t overall;
+    questionstats_t *stats = retrieve_question_stats(db, &count, &overall);
+    if (stats == NULL) {
+        sqlite3_close(db);
+        return false;
+    }
+
+    fprintf(stream, "QUIZBIT ━━ QUESTION REPORT\n\n");
+    fprintf(stream, "%u answers over %zu questions", overall.count, count);
+    if (overall.count > 0) {
+        fprintf(stream, " : p50 %.1fs, p90 %.1fs, p99 %.1fs, max %.1fs",
+                hist_percentile(&overall, 0.50) / 1000.0, hist_percentile(&overall, 0.90) / 1000.0,
+                hist_percentile(&overall, 0.99) / 1000.0, overall.max / 1000.0);
+    }
+    fprintf(stream, "\n");
+
+    char question[QUESTION_SIZE];
+
+    //? The questions only ever skipped have no answer time, they are listed in the next section
+    qsort(stats, count, sizeof(questionstats_t), compare_slowest);
+    fprintf(stream, "\nSLOWEST QUESTIONS (90th percentile of the answer time)\n");
+    fprintf(stream, "%-8s %4s %7s %7s %7s  %s\n", "CATEGORY", "ID", "ANSWERS", "P50", "P90", "QUESTION");
+    for (size_t i = 0, listed = 0; i < count && listed < limit; i++) {
+        if (stats[i].answers == 0) {
+            continue;
+        }
+        get_question_text(db, &stats[i], question, sizeof(question));
+        fprintf(stream, "%-8s %4d %7u %6.1fs %6.1fs  %.60s\n", stats[i].category, stats[i].question_id,
+                stats[i].answers, stats[i].p50 / 1000.0, stats[i].p90 / 1000.0, question);
+        listed++;
+    }
+
+    qsort(stats, count, sizeof(questionstats_t), compare_skipped);
+    fprintf(stream, "\nMOST SKIPPED QUESTIONS\n");
+    fprintf(stream, "%-8s %4s %7s %7s %7s  %s\n", "CATEGORY", "ID", "SHOWN", "SKIPPED", "RATE", "QUESTION");
+    for (size_t i = 0, listed = 0; i < count && listed < limit; i++) {
+        if (stats[i].skipped == 0) {
+            break;
+        }
+        get_question_text(db, &stats[i], question, sizeof(question));
+        fprintf(stream, "%-8s %4d %7u %7u %6.0f%%  %.60s\n", stats[i].category, stats[i].question_id,
+                stats[i].shown, stats[i].skipped, 100.0 * stats[i].skipped / stats[i].shown, question);
+        listed++;
+    }
+
+    free(stats);
+    sqlite3_close(db);
+    return true;
+}
@@ -1,30 +1,52 @@
 #include "../include/db.h"
 #include "../include/console.h"
+#include "../include/layout.h"
+#include "../include/scene.h"
+#include "../include/output.h"
 
 
 /**
  * @brief Ehh main function
- *        Calls the functions that sets up the signal handlers for SIGINT, SIGSEGV, & SIGWINCH,
- *        Function that stores the default terminal attribute to a termios structure
+ *        Starts the logger, whose records are written to the log file by a background thread
+ *        Calls the functions that sets up the signal handlers for SIGINT & SIGSEGV,
+ *        Function that stores the default terminal attribute to a termios structure & lays out the screens
  *        Calls the setup functionthat set's up the database & initializes all the demo player accounts
- *        Then calls the homepage function if no error is encountered
+ *        Then runs the scenes of the game from the homepage if no error is encountered, until the player quits,
+ *        & waits for the questions still read in the background for the next game
+ *        With --report, prints the report of the questions for the admin instead, without the terminal UI,
+ *        the status lines of the setup go to stderr so stdout only holds the report
+ *
+ * @param argc The number of command line arguments
+ * @param argv The command line arguments
  *
  * @return Exit Status Code ie: EXIT_SUCCESS '0' or EXIT_FAILURE '1'
  */
-int main(void) {
+int main(int argc, char *argv[]) {
+    log_init();
+    const bool report = argc > 1 && strcmp(argv[1], "--report") == 0;
+    if (report) {
+        out_set_fd(STDERR_FILENO);
+    }
     if (!setup()) {
         return EXIT_FAILURE;
     }
 
-    setlocale(LC_ALL, "en_US.UTF-8");
+    if (report) {
+        return print_question_report(stdout, 10) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (setlocale(LC_ALL, "en_US.UTF-8") == NULL) {
+        setlocale(LC_ALL, "C.UTF-8");
+    }
 
     initialize_terminal();
     setup_signal_handler();
 
-    int offset_position;
-    setup_sigwinch_handler(&offset_position);
-
-    homepage(offset_position);
+    session_t session = {.box_offset = layout_box_offset(), .category = NULL, .mode = EDITACCOUNT};
+    rng_init(&session.rng);
+    scene_run(&session, SCENE_HOMEPAGE);
+    prefetch_discard();
 
+    restore_terminal();
     return EXIT_SUCCESS;
 }
\ No newline at end of file
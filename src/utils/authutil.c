@@ -47,9 +47,9 @@ bool regex_match(regex_t *regex, const char *pattern, const char *string) {
         return true;
     }
 
+    //? Not matching is the normal outcome of an invalid input, it isn't an error
     if (ret == REG_NOMATCH) {
         regfree(regex);
-        log_error(__func__, __FILE__, __LINE__, "regexec : REG_NOMATCH!...\n");
         return false;
     }
 
@@ -0,0 +1,411 @@
+#include "../../include/db.h"
+#include "../../include/crash.h"
+#include "../../include/events.h"
+#include "../../include/utilities.h"
+
+#include <sys/auxv.h>
+#include <sys/mman.h>
+
+
+// TODO : A UI event kept for the report
+typedef struct CRASH_RECORD {
+    uint64_t time;      //? Milliseconds of the monotonic clock
+    int32_t  kind;
+    int32_t  a;
+    int32_t  b;
+} crecord_t;
+
+// TODO : A line of the report, formatted without the stdio functions
+typedef struct CRASH_LINE_BUFFER {
+    char   data[CRASH_LINE];
+    size_t len;
+} cline_t;
+
+// TODO : State of the crash reporter, everything the handler touches is set up by 'crash_init'
+static struct CRASH_STATE {
+    int            fd;
+    bool           restore;              //? stdin is a terminal, its attributes are restored
+    bool           escapes;              //? stdout is a terminal, the alternate screen is left
+    struct termios attributes;
+    atomic_size_t  next;                 //? Events recorded so far, they are only recorded by the UI thread
+    crecord_t      events[CRASH_EVENTS];
+    atomic_int     connections;          //? Database connections open
+    void          *frames[CRASH_FRAMES];
+} crash = {.fd = VALUE_ERROR};
+
+//? Last statement run by the thread, without its bound values. Each thread writes its own, so the thread that
+//? crashed reports the statement it ran, never a mix of two statements of different threads.
+static _Thread_local char last_sql[CRASH_SQL];
+
+// TODO : Alternate signal stack of the thread, 'depth' counts the nested calls to 'crash_thread_begin'
+static _Thread_local struct CRASH_THREAD {
+    stack_t stack;
+    size_t  depth;
+} thread;
+
+static volatile sig_atomic_t crashing;
+
+//? Leaves the alternate screen, the bracketed paste & the synchronized update, & shows the cursor
+static const char RESET_SEQ[] = "\033[0m\033[?25h\033[?2026l\033[?2004l\033[?1049l";
+static const char NOTICE[] = "\r\nPROGRAM TERMINATED : \n\tThe crash report is logged in the file located in " ERROR_LOGPATH "\n";
+
+static const int FATAL_SIGNALS[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+
+/**
+ * @brief This function writes a buffer to a file descriptor, a failed write is ignored
+ */
+static void crash_write(const int fd, const char *data, const size_t len) {
+    for (size_t done = 0; fd != VALUE_ERROR && done < len;) {
+        const ssize_t n = write(fd, data + done, len - done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return;
+        }
+        done += (size_t)n;
+    }
+}
+
+
+/**
+ * @brief This function appends a null-terminated string to a line, what doesn't fit is cut
+ */
+static void line_str(cline_t *line, const char *str) {
+    for (; str != NULL && *str != NULL_TERM && line->len < CRASH_LINE - 1; str++) {
+        line->data[line->len++] = *str == ENTER_KEY ? SPACE_BAR : *str;
+    }
+}
+
+
+/**
+ * @brief This function appends an integer to a line, in decimal or in hexadecimal with a '0x' prefix
+ */
+static void line_int(cline_t *line, const long long value, const bool hex) {
+    char digits[0x18];
+    size_t n = 0;
+    unsigned long long v = !hex && value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+    const unsigned base = hex ? 16U : 10U;
+
+    do {
+        digits[n++] = "0123456789abcdef"[v % base];
+        v /= base;
+    } while (v > 0 && n < sizeof(digits));
+
+    line_str(line, !hex && value < 0 ? "-" : hex ? "0x" : "");
+    while (n > 0 && line->len < CRASH_LINE - 1) {
+        line->data[line->len++] = digits[--n];
+    }
+}
+
+
+/**
+ * @brief This function writes a line to the log file, ended by a newline, & empties it
+ */
+static void line_flush(cline_t *line) {
+    line->data[line->len++] = ENTER_KEY;
+    crash_write(crash.fd, line->data, line->len);
+    line->len = 0;
+}
+
+
+/**
+ * @returns The name of a signal, strsignal() isn't async-signal-safe
+ */
+static const char *signal_name(const int sig) {
+    switch (sig) {
+        case SIGSEGV : return "SIGSEGV (Segmentation fault)";
+        case SIGBUS  : return "SIGBUS (Bus error)";
+        case SIGFPE  : return "SIGFPE (Arithmetic exception)";
+        case SIGILL  : return "SIGILL (Illegal instruction)";
+        case SIGABRT : return "SIGABRT (Aborted)";
+        case SIGINT  : return "SIGINT (Interrupted)";
+        default      : return "signal";
+    }
+}
+
+
+/**
+ * @brief This function writes the UI events kept for the report, the oldest first, with their age
+ *
+ * @param line A pointer to the line used to format them
+ * @param now The time of the crash
+ */
+static void report_events(cline_t *line, const uint64_t now) {
+    const size_t next = atomic_load(&crash.next);
+    const size_t count = next < CRASH_EVENTS ? next : CRASH_EVENTS;
+    line_str(line, "---- last ");
+    line_int(line, (long long)count, false);
+    line_str(line, " UI events, the oldest first");
+    line_flush(line);
+
+    for (size_t i = next - count; i < next; i++) {
+        const crecord_t *event = &crash.events[i & (CRASH_EVENTS - 1)];
+        line_int(line, -(long long)(now - event->time), false);
+        line_str(line, " ms : ");
+
+        if (event->kind == CRASH_KEY) {
+            line_str(line, "key ");
+            line_int(line, event->a, false);
+            if (event->a >= SPACE_BAR && event->a < BACKSPACE) {
+                const char key[] = {' ', '\'', (char)event->a, '\'', NULL_TERM};
+                line_str(line, key);
+            }
+            line_str(line, ", modifiers ");
+            line_int(line, event->b, false);
+        }
+        else if (event->kind == CRASH_SCENE) {
+            line_str(line, "scene ");
+            line_int(line, event->a, false);
+            line_str(line, ", stack depth ");
+            line_int(line, event->b, false);
+        }
+        else if (event->kind == CRASH_RESIZE) {
+            line_str(line, "resize ");
+            line_int(line, event->a, false);
+            line_str(line, "x");
+            line_int(line, event->b, false);
+        }
+        line_flush(line);
+    }
+}
+
+
+/**
+ * @brief This function writes the crash report to the log file with async-signal-safe calls only
+ *
+ * @param sig The signal received
+ * @param info A pointer to the details of the signal
+ */
+static void crash_report(const int sig, const siginfo_t *info) {
+    cline_t line = {.len = 0};
+    const uint64_t now = events_now();
+
+    line_str(&line, "==== CRASH REPORT : ");
+    line_str(&line, signal_name(sig));
+    line_str(&line, ", pid ");
+    line_int(&line, getpid(), false);
+    line_str(&line, ", time ");
+    line_int(&line, (long long)time(NULL), false);
+    //? Only a fault raised by the kernel has an address, a signal sent by kill() has the pid of its sender
+    if (info != NULL && info->si_code > 0) {
+        line_str(&line, ", fault address ");
+        line_int(&line, (long long)(uintptr_t)info->si_addr, true);
+    }
+    line_flush(&line);
+
+    line_str(&line, "---- backtrace");
+    line_flush(&line);
+    const int frames = backtrace(crash.frames, CRASH_FRAMES);
+    if (crash.fd != VALUE_ERROR) {
+        backtrace_symbols_fd(crash.frames, frames, crash.fd);
+    }
+
+    report_events(&line, now);
+
+    line_str(&line, "---- database ");
+    line_str(&line, DBFILEPATH);
+    line_str(&line, ", ");
+    line_int(&line, atomic_load(&crash.connections), false);
+    line_str(&line, " connections open, last statement of the thread : ");
+    line_str(&line, last_sql[0] != NULL_TERM ? last_sql : "none");
+    line_flush(&line);
+
+    line_str(&line, "==== END OF CRASH REPORT");
+    line_flush(&line);
+}
+
+
+/**
+ * @brief This function handles the fatal signals on the alternate stack. It restores the terminal, writes
+ *        the report & raises the signal again with its default action, so a core dump is still produced.
+ *
+ * @param sig The signal received
+ * @param info A pointer to the details of the signal
+ * @param context no use
+ */
+static void crash_handler(const int sig, siginfo_t *info, void *context) {
+    (void)context;
+    if (!crashing) {
+        crashing = 1;
+        if (crash.escapes) {
+            crash_write(STDOUT_FILENO, RESET_SEQ, sizeof(RESET_SEQ) - 1);
+        }
+        if (crash.restore) {
+            tcsetattr(STDIN_FILENO, TCSANOW, &crash.attributes);
+        }
+        crash_report(sig, info);
+        crash_write(STDERR_FILENO, NOTICE, sizeof(NOTICE) - 1);
+    }
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+
+/**
+ * @brief This function is called by SQLite on every statement run & every connection closed
+ *
+ * @returns 0
+ */
+static int crash_db_trace(const unsigned type, void *ctx, void *p, void *x) {
+    (void)ctx;
+    (void)p;
+    if (type == SQLITE_TRACE_CLOSE) {
+        atomic_fetch_sub(&crash.connections, 1);
+        return 0;
+    }
+
+    //? The text of the statement, with its parameters unexpanded so no password is kept
+    const char *sql = x;
+    size_t i = 0;
+    for (; sql != NULL && sql[i] != NULL_TERM && i < CRASH_SQL - 1; i++) {
+        last_sql[i] = sql[i] == ENTER_KEY ? SPACE_BAR : sql[i];
+    }
+    last_sql[i] = NULL_TERM;
+    return 0;
+}
+
+
+/**
+ * @brief This function is registered as an SQLite auto extension, so it is called on every connection opened
+ *
+ * @returns SQLITE_OK
+ */
+static int crash_db_open(sqlite3 *db, char **err, const void *api) {
+    (void)err;
+    (void)api;
+    atomic_fetch_add(&crash.connections, 1);
+    sqlite3_trace_v2(db, SQLITE_TRACE_STMT | SQLITE_TRACE_CLOSE, crash_db_trace, NULL);
+    return SQLITE_OK;
+}
+
+
+/**
+ * @brief This function handles a signal with the crash reporter
+ *
+ * @param sig The signal
+ *
+ * @returns true if the handler is installed, otherwise false
+ */
+bool crash_handle(const int sig) {
+    struct sigaction sa = {0};
+    sa.sa_sigaction = crash_handler;
+    sa.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESETHAND;
+    sigfillset(&sa.sa_mask);
+    return sigaction(sig, &sa, NULL) == VALUE_SUCCESS;
+}
+
+
+/**
+ * @brief This function maps an alternate signal stack for the calling thread, sigaltstack() only applies to
+ *        the thread calling it, so every thread that may overflow its stack (the UI thread, the threads of the
+ *        tasks & the flusher of the logger) calls it when it starts, for its overflow to be reported.
+ *        The signal frame of the kernel grows with the registers of the CPU (ie: AVX-512, AMX), so the stack
+ *        is sized from the minimum the kernel reports, with room for the handler & the unwinder above it.
+ *        A thread that already has its stack keeps it (ie: a task run inline by the UI thread).
+ *
+ * @returns true if the stack is installed, otherwise false
+ */
+bool crash_thread_begin(void) {
+    if (thread.depth++ > 0) {
+        return true;
+    }
+
+    size_t size = CRASH_STACK;
+#ifdef AT_MINSIGSTKSZ
+    const size_t minimum = (size_t)getauxval(AT_MINSIGSTKSZ);
+    if (minimum + CRASH_UNWIND > size) {
+        size = minimum + CRASH_UNWIND;
+    }
+#endif
+    const long page = sysconf(_SC_PAGESIZE);
+    if (page > 0) {
+        size = (size + (size_t)page - 1) / (size_t)page * (size_t)page;
+    }
+
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, VALUE_ERROR, 0);
+    if (base == MAP_FAILED) {
+        log_error(__func__, __FILE__, __LINE__, "mmap() : %s\n", strerror(errno));
+        return false;
+    }
+    const stack_t stack = {.ss_sp = base, .ss_size = size, .ss_flags = 0};
+    if (sigaltstack(&stack, NULL) == VALUE_ERROR) {
+        log_error(__func__, __FILE__, __LINE__, "sigaltstack() : %s\n", strerror(errno));
+        munmap(base, size);
+        return false;
+    }
+    thread.stack = stack;
+    return true;
+}
+
+
+/**
+ * @brief This function removes & unmaps the alternate signal stack of the calling thread, once the calls
+ *        to 'crash_thread_begin' are all matched. It is called by a thread before it returns.
+ */
+void crash_thread_end(void) {
+    if (thread.depth == 0 || --thread.depth > 0 || thread.stack.ss_sp == NULL) {
+        return;
+    }
+    const stack_t disable = {.ss_sp = NULL, .ss_size = 0, .ss_flags = SS_DISABLE};
+    sigaltstack(&disable, NULL);
+    munmap(thread.stack.ss_sp, thread.stack.ss_size);
+    thread.stack = (stack_t){0};
+}
+
+
+/**
+ * @brief This function sets up the crash reporter, it is called once the terminal is initialized.
+ *        The log file is opened, the alternate signal stack of the UI thread is installed, the unwinder is loaded,
+ *        & the fatal signals (SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT) are handled.
+ *
+ * @returns true if the crash reporter is fully set up, otherwise false
+ */
+bool crash_init(void) {
+    bool ok = true;
+    crash.fd = open(ERROR_LOGPATH, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (crash.fd == VALUE_ERROR) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to open %s : %s, crashes won't be reported!...\n",
+                  ERROR_LOGPATH, strerror(errno));
+        ok = false;
+    }
+
+    crash.restore = isatty(STDIN_FILENO);
+    crash.escapes = isatty(STDOUT_FILENO);
+    crash.attributes = default_term_attr;
+
+    //? The first call of backtrace() loads the unwinder, which allocates, so it is done here
+    backtrace(crash.frames, 1);
+
+    if (!crash_thread_begin()) {
+        ok = false;
+    }
+    if (sqlite3_auto_extension((void (*)(void))crash_db_open) != SQLITE_OK) {
+        log_error(__func__, __FILE__, __LINE__, "Failed to follow the database connections!...\n");
+        ok = false;
+    }
+
+    for (size_t i = 0; i < sizeof(FATAL_SIGNALS) / sizeof(FATAL_SIGNALS[0]); i++) {
+        if (!crash_handle(FATAL_SIGNALS[i])) {
+            log_error(__func__, __FILE__, __LINE__, "sigaction(%i) : %s\n", FATAL_SIGNALS[i], strerror(errno));
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+
+/**
+ * @brief This function records a UI event for the crash report, it is only called by the UI thread
+ *
+ * @param kind The kind of the event
+ * @param a The first value of the event (ie: the key code)
+ * @param b The second value of the event (ie: the modifiers)
+ */
+void crash_event(const cevent_t kind, const int32_t a, const int32_t b) {
+    const size_t next = atomic_load_explicit(&crash.next, memory_order_relaxed);
+    crash.events[next & (CRASH_EVENTS - 1)] = (crecord_t){.time = events_now(), .kind = (int32_t)kind, .a = a, .b = b};
+    //? The record is complete before it is counted, even for a handler interrupting the UI thread
+    atomic_store_explicit(&crash.next, next + 1, memory_order_release);
+}
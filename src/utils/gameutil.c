@@ -1,44 +1,55 @@
 #include "../../include/gamecore.h"
 #include "../../include/utilities.h"
+#include "../../include/render.h"
+#include "../../include/keys.h"
+#include "../../include/width.h"
+#include "../../include/template.h"
+#include "../../include/events.h"
 
 
 /**
  * @brief This function gets the padding value of the item to be printed within the box
  *
- * @param item The length of the string/item to be printed
+ * @param item The display width of the string/item to be printed (ie: from 'width_str')
  *
- * @returns the offset value of the string/item to be printed
+ * @returns the offset value of the string/item to be printed, 0 if it is wider than the box
  */
 int get_padding(const size_t item) {
-    return (MIN_BOX_WIDTH - item) / 2;
+    return item < MIN_BOX_WIDTH ? (int)(MIN_BOX_WIDTH - item) / 2 : 0;
 }
 
 
 /**
- * @brief This function converts the given rgb values to 256 bit mode
+ * @brief This function appends a typed byte to the line being read & echoes it.
+ *        Past the size of the array, the characters are only counted so the user sees the line is too long.
  *
- * @param rgb RGB color structure
- *
- * @returns The 256-bit equivalent of the RGB values passed
+ * @param ch The byte typed
+ * @param array A pointer to the character array storing the line
+ * @param size The size of the character array
+ * @param len A pointer to the length of the line
+ * @param overflow A pointer to the count of characters that didn't fit
  */
-uint8_t rgb_256(const RGB_t rgb) {
-    const uint8_t R_index = (uint8_t)round((double)rgb.red / RGB_MAX * BIT_MODE);
-    const uint8_t G_index = (uint8_t)round((double)rgb.green / RGB_MAX * BIT_MODE);
-    const uint8_t B_index = (uint8_t)round((double)rgb.blue / RGB_MAX * BIT_MODE);
-
-    return BIT_OFFSET + R_index * R_FACTOR + G_index * G_FACTOR + B_index * B_FACTOR;
+static void append_char(const char ch, char *array, const size_t size, size_t *len, size_t *overflow) {
+    if (*len < size - 1 && *overflow == 0) {
+        array[(*len)++] = ch;
+    }
+    else if (((unsigned char)ch & 0xC0) != 0x80) {
+        *overflow += 1;
+    }
+    print("%c", ch);
 }
 
 
 /**
- * @brief This function reads user input from the specified stream using fgets
- *        and replaces the trailing newline character with a null character.
+ * @brief This function reads a line of user input from the input layer & echoes it on the screen.
+ *        Backspace removes the last character, pasted text is inserted, other keys are ignored.
  *
  * @param prompt A pointer to the prompt message to be displayed before reading input.
  * @param array A pointer to the character array to store the user input.
  * @param size The size of the character array.
  *
- * @returns the length of the array if successful, 0 if not read, or -1 if an error is encountered
+ * @returns the length of the array if successful, NULL_STRING if the input doesn't fit in the array,
+ *          or -1 if an error is encountered
  */
 ssize_t input(const char *prompt, char *array, const size_t size) {
     if (prompt != NULL) {
@@ -51,19 +62,39 @@ ssize_t input(const char *prompt, char *array, const size_t size) {
         return NULL_STRING;
     }
 
-    if (fgets(array, size, stdin) == NULL) {
-        return VALUE_ERROR;
-    }
-
-    ssize_t len = strlen(array);
-    if (len < 1 || array[len - 1] != ENTER_KEY) {
-        return NULL_STRING;
+    size_t len = 0, overflow = 0;
+    int c;
+    while ((c = cgetch()) != ENTER_KEY) {
+        if (c == BACKSPACE || c == '\b') {
+            if (overflow > 0) {
+                overflow -= 1;
+                del_char(1);
+            }
+            else if (len > 0) {
+                //? Remove the continuation bytes of a UTF-8 character together with its lead byte
+                do {
+                    len -= 1;
+                } while (len > 0 && ((unsigned char)array[len] & 0xC0) == 0x80);
+                del_char(1);
+            }
+        }
+        else if (c == PASTE_KEY) {
+            size_t paste_len;
+            const char *text = keys_paste(&paste_len);
+            for (size_t i = 0; i < paste_len; i++) {
+                if ((unsigned char)text[i] >= SPACE_BAR && text[i] != BACKSPACE) {
+                    append_char(text[i], array, size, &len, &overflow);
+                }
+            }
+        }
+        else if (c >= SPACE_BAR && c <= UINT8_MAX) {
+            append_char((char)c, array, size, &len, &overflow);
+        }
     }
 
-    len -= 1;
     array[len] = NULL_TERM;
     set_console_cursor_mode(DISABLE);
-    return len;
+    return overflow > 0 ? NULL_STRING : (ssize_t)len;
 }
 
 
@@ -93,11 +124,23 @@ ssize_t get_pass(const char *prompt, char *passwd, const size_t size) {
     int c;
     size_t len = 0;
     while ((c = cgetch()) != ENTER_KEY && len < size - 1) {
-        if (c == BACKSPACE && len > 0) {
-            del_char(1);
-            len -= 1;
+        if (c == BACKSPACE || c == '\b') {
+            if (len > 0) {
+                del_char(1);
+                len -= 1;
+            }
         }
-        else if (c != BACKSPACE) {
+        else if (c == PASTE_KEY) {
+            size_t paste_len;
+            const char *text = keys_paste(&paste_len);
+            for (size_t i = 0; i < paste_len && len < size - 1; i++) {
+                if ((unsigned char)text[i] >= SPACE_BAR && text[i] != BACKSPACE) {
+                    passwd[len++] = text[i];
+                    print("%s", DOT_EMOJI);
+                }
+            }
+        }
+        else if (c >= SPACE_BAR && c <= UINT8_MAX) {
             passwd[len] = (char)c;
             print("%s", DOT_EMOJI);
             len += 1;
@@ -118,18 +161,13 @@ ssize_t get_pass(const char *prompt, char *passwd, const size_t size) {
  * @param length The length/frame size of the progress bar.
  */
 void progress_bar(const size_t progress, const size_t length) {
-    const RGB_t colors[] = {
-        {255, 215, 0},   //? Gold
-        {112, 128, 144}  //? Slate Grey
-    };
-
     for (size_t i = 0; i < length; ++i) {
         if (i < progress) {
-            set_bg_color(rgb_256(colors[0]));
+            set_console_theme(THEME_PROGRESS_DONE);
             print(" ");
         }
         else {
-            set_bg_color(rgb_256(colors[1]));
+            set_console_theme(THEME_PROGRESS_LEFT);
             print(" ");
         }
         set_console_text_attr(RESET_ATTR);
@@ -138,80 +176,163 @@ void progress_bar(const size_t progress, const size_t length) {
 }
 
 
+// TODO : State of a loader animation driven by a timer of the event loop
+typedef struct LOADER_ANIMATION {
+    int           x;
+    int           y;
+    size_t        frame;
+    uint64_t      until;  //? The loader stays up at least until this time, even if the task is done
+    task_t       *task;
+    volatile bool done;
+} anim_t;
+
+
+/**
+ * @brief This function reads the minimum time a loader stays on the screen, from the environment variable
+ *        QUIZBIT_LOADER_MIN_MS. Without it, a loader disappears as soon as its task completes.
+ *
+ * @returns The minimum display time in milliseconds
+ */
+static uint32_t loader_min_time(void) {
+    static long min_time = VALUE_ERROR;
+    if (min_time == VALUE_ERROR) {
+        const char *env = getenv("QUIZBIT_LOADER_MIN_MS");
+        char *end = NULL;
+        min_time = env != NULL ? strtol(env, &end, 10) : 0;
+        if (env != NULL && (end == env || *end != NULL_TERM || min_time < 0 || min_time > UINT16_MAX)) {
+            log_error(__func__, __FILE__, __LINE__, "Invalid QUIZBIT_LOADER_MIN_MS value '%s'!...\n", env);
+            min_time = 0;
+        }
+    }
+    return (uint32_t)min_time;
+}
+
+
+/**
+ * @brief This function runs the event loop while the frames of a loader are drawn by a timer,
+ *        until its task completes & the minimum display time has passed
+ *
+ * @param anim A pointer to the state of the animation
+ * @param draw_frame The function drawing one frame of the loader
+ *
+ * @returns The result of the task
+ */
+static bool run_loader(anim_t *anim, const timer_cb draw_frame) {
+    anim->until = events_now() + loader_min_time();
+    anim->done = false;
+    draw_frame(anim);
+
+    const int timer = events_add_timer(FRAME_DELAY, true, draw_frame, anim);
+    if (timer != NO_TIMER) {
+        events_run_until(&anim->done);
+        events_cancel_timer(timer);
+    }
+    return task_wait(anim->task);
+}
+
+
+/**
+ * @brief This function draws the progress bar at the progress of the task, it is called by a timer of the event loop
+ *
+ * @param context A pointer to the state of the animation
+ */
+static void progress_bar_frame(void *context) {
+    anim_t *anim = context;
+    const bool finished = task_done(anim->task);
+    const uint32_t progress = atomic_load(&anim->task->progress);
+
+    set_console_cursor_position(anim->x, anim->y);
+    progress_bar(progress * FRAME_SIZE / TASK_FINISHED, FRAME_SIZE);
+
+    anim->done = finished && events_now() >= anim->until;
+}
+
+
 /**
  * @brief This function calls the 'progress bar' function
- *        and displays a loader before starting any new game
+ *        and displays a loader before starting any new game.
+ *        The bar follows the progress of the task & disappears as soon as it completes,
+ *        the event loop keeps reading input & handling signals meanwhile.
  *
  * @param x X-coordinate value of the cursor
  * @param y Y-coordinate value of the cursor
  * @param message A pointer to the message to be displayed while the loader is running.
+ * @param task A pointer to the task loading the game
+ *
+ * @returns The result of the task, the player is only asked to start the game if it succeeded
  */
-void display_progress_bar(const int x, const int y, const char *message) {
+bool display_progress_bar(const int x, const int y, const char *message, task_t *task) {
     int tmp_x;
     if (message != NULL) {
-        tmp_x = get_padding(strlen(message));
+        tmp_x = get_padding(width_str(message));
         mvprint(x + tmp_x, y, BOLD, "%s", message);
     }
 
     tmp_x = get_padding(FRAME_SIZE);
 
-    for (size_t i = 0; i <= FRAME_SIZE; ++i) {
-        set_console_cursor_position(x + tmp_x, y + 2);
-        progress_bar(i, FRAME_SIZE);
-        delay(50); //? milliseconds
+    anim_t anim = {.x = x + tmp_x, .y = y + 2, .frame = 0, .task = task};
+    if (!run_loader(&anim, progress_bar_frame)) {
+        return false;
     }
 
     mvprint(x + tmp_x + PROMPT_PADDING, y + 4, BOLD, "Press any key to start : ");
     cgetch();
+    return true;
 }
 
 
 /**
- * @brief This function displays a loader while user credentials authenticate.
+ * @brief This function draws the next frame of the spinning loader, it is called by a timer of the event loop
  *
- * @param x X-coordinate value of the cursor
- * @param y Y-coordinate value of the cursor
- * @param message A pointer to the message to be displayed while the loader is running.
+ * @param context A pointer to the state of the animation
  */
-void display_loader(const int x, const int y, const char *message) {
+static void loader_frame(void *context) {
     const char *char_set[] = {"◒", "◐", "◓", "◑"};
     const size_t char_size = sizeof(char_set) / sizeof(char_set[0]);
 
+    anim_t *anim = context;
+    print("%s \b\b", char_set[anim->frame % char_size]);
+
+    anim->frame += 1;
+    anim->done = task_done(anim->task) && events_now() >= anim->until;
+}
+
+
+/**
+ * @brief This function displays a loader while a task runs (ie: user credentials authenticate).
+ *        The loader disappears as soon as the task completes, the event loop keeps reading input
+ *        & handling signals meanwhile.
+ *
+ * @param x X-coordinate value of the cursor
+ * @param y Y-coordinate value of the cursor
+ * @param message A pointer to the message to be displayed while the loader is running.
+ * @param task A pointer to the task the loader waits for
+ *
+ * @returns The result of the task
+ */
+bool display_loader(const int x, const int y, const char *message, task_t *task) {
     if (message != NULL) {
         mvprint(x, y, BOLD, "[%s] %s", LOADING_EMOJI, message);
     }
 
-    for (size_t i = 0; i < FRAME_SIZE; i++) {
-        print("%s \b\b", char_set[i % char_size]);
-        delay(50); //? sleep 50 milliseconds
-    }
+    anim_t anim = {.x = x, .y = y, .frame = 0, .task = task};
+    return run_loader(&anim, loader_frame);
 }
 
 
 /**
- * @brief This function uses the getch function and listens for only the arrow keys
+ * @brief This function filters the arrow keys out of the decoded key presses
  * @param key The value of the key pressed
  * 
- * @returns the integer value of the left/right/up/down keys
+ * @returns the integer value of the left/right/up/down keys, otherwise -1
  */
-int get_arrow_key(int key) {
-    if (key != ESC_KEY) {
-        return VALUE_ERROR;
-    }
-    key = cgetch();
-    if (key != LEFT_SQB) { //? handle the '[' character
-        return VALUE_ERROR;
-    }
-    key = cgetch();
+int get_arrow_key(const int key) {
     switch (key) {
         case UP_KEY:
-            return UP_KEY;
         case DOWN_KEY:
-            return DOWN_KEY;
         case LEFT_KEY:
-            return LEFT_KEY;
         case RIGHT_KEY:
-            return RIGHT_KEY;
+            return key;
         default:
             return VALUE_ERROR;
     }
@@ -247,38 +368,68 @@ int highlight_line(const int key, const int len, const int line) {
 }
 
 
+/**
+ * @brief This function reads a burst of key presses for a menu & moves the highlighted line with the arrow keys.
+ *        The keys already waiting (ie: a held arrow key) are applied in sequence before returning,
+ *        so the menu is drawn once per burst instead of once per key press.
+ *
+ * @param len The number of lines in the menu list
+ * @param highlight A pointer to the currently highlighted line number
+ *
+ * @returns true if ENTER was pressed on the highlighted line, otherwise false
+ */
+bool read_menu_keys(const int len, int *highlight) {
+    kevent_t event;
+    int key = cgetch();
+    for (;;) {
+        if (key == ENTER_KEY) {
+            return true;
+        }
+        const int arrow_key = get_arrow_key(key);
+        if (arrow_key != VALUE_ERROR) {
+            *highlight = highlight_line(arrow_key, len, *highlight);
+        }
+        //? The keys typed after ENTER stay in the input layer for the next screen
+        if (!keys_pending()) {
+            return false;
+        }
+        key = keys_read(&event);
+    }
+}
+
+
 /**
  * @brief This function displays a banner containing a title text with characters on both sides.
  *
- * @param colors A pointer to the set of RGB colors for styling the text foreground & background
+ * @param themes A pointer to the color themes for styling the text foreground & background
  * @param content A pointer to the heading/text to be displayed in the banner.
  */
-void display_banner(const RGBset_t *colors, const char *content) {
-    if (colors == NULL || content == NULL) {
+void display_banner(const themes_t *themes, const char *content) {
+    if (themes == NULL || content == NULL) {
         log_error(__func__, __FILE__, __LINE__, "NULL INPUT PARAMETERS!...\n");
         return;
     }
     for (size_t i = 0; i < LEFT_PADDING; i++) {
         if (i % 2 == 0) {
-            set_console_color_attr(colors[0]);
+            set_console_theme(themes[0]);
             mvprint(NUL, NUL, BOLD, "%s", LBANNER_EMOJI);
         }
         else {
-            set_console_color_attr(colors[1]);
+            set_console_theme(themes[1]);
             mvprint(NUL, NUL, BOLD, "%s", LBANNER_EMOJI);
         }
     }
 
-    set_console_color_attr(colors[1]);
+    set_console_theme(themes[1]);
     mvprint(NUL, NUL, BOLD, "%s", content);
 
     for (size_t i = 0; i < RIGHT_PADDING; i++) {
         if (i % 2 == 0) {
-            set_console_color_attr(colors[0]);
+            set_console_theme(themes[0]);
             mvprint(NUL, NUL, BOLD, "%s", RBANNER_EMOJI);
         }
         else {
-            set_console_color_attr(colors[1]);
+            set_console_theme(themes[1]);
             mvprint(NUL, NUL, BOLD, "%s", RBANNER_EMOJI);
         }
     }
@@ -293,27 +444,20 @@ void display_banner(const RGBset_t *colors, const char *content) {
  * @param box_offset The offset position of the box, which helps in determining the padding value of the banner and player info
  */
 void display_header(const int box_offset, const char *content, pstats_t *player) {
-    const RGBset_t colors[] = {
-        { //? YELLOW on DARK RED
-            .foreground = {255, 255, 0},
-            .background = {178, 0, 0}
-        },
-        { //? BLACK on WHITE
-            .foreground = {0, 0, 0},
-            .background = {255, 255, 255}
-        }
+    const themes_t themes[] = {
+        THEME_BANNER,   //? YELLOW on DARK RED
+        THEME_HIGHLIGHT //? BLACK on WHITE
     };
 
     //? Offset position of the banner
-    const int banner_padding = get_padding(3 * (LEFT_PADDING + RIGHT_PADDING) + strlen(content) - 4);
-    //? '3' because the emojis on the banner are a combination of 3 different emojis
-    //? '-4' because strlen returns '3' for an emoji and the content of the banner has 2 dash emojis
+    const int banner_padding = get_padding(LEFT_PADDING * width_str(LBANNER_EMOJI) + width_str(content) +
+                                           RIGHT_PADDING * width_str(RBANNER_EMOJI));
 
     const int y = HEADER_HEIGHT;
     const int x = box_offset;
 
     set_console_cursor_position(x + banner_padding, y);
-    display_banner(colors, content);
+    display_banner(themes, content);
 
     if (player != NULL) {
         char sub_heading[MIN_BUFF] = {0};
@@ -322,15 +466,41 @@ void display_header(const int box_offset, const char *content, pstats_t *player)
             PROFILE_EMOJI, player->profile.username, ID_EMOJI, player->profile.playerId,
             SPORTS_EMOJI, player->scores.currentScore);
 
-        const int padding = get_padding(strlen(sub_heading) - 10);
+        const int padding = get_padding(width_str(sub_heading));
         mvprint(x + padding, y + 2, BOLD, "%s", sub_heading);
     }
 }
 
 
+/**
+ * @brief This function hashes what a main page is drawn from into the key of its template
+ *
+ * @returns The key of the template
+ */
+static uint64_t main_page_key(const int box_offset, const size_t len, const pstats_t *player, const char *heading,
+    const char *sub_heading, char emojis[][BADGE_SIZE], char menus[][BUF_SIZE]) {
+
+    uint64_t key = template_hash(0, &box_offset, sizeof(box_offset));
+    key = template_hash_str(key, heading);
+    key = template_hash_str(key, sub_heading);
+    if (player != NULL) {
+        key = template_hash_str(key, player->profile.username);
+        key = template_hash_str(key, player->profile.playerId);
+        key = template_hash(key, &player->scores.currentScore, sizeof(player->scores.currentScore));
+    }
+    for (size_t i = 0; i < len; i++) {
+        key = template_hash_str(key, emojis[i]);
+        key = template_hash_str(key, menus[i]);
+    }
+    return key;
+}
+
+
 /**
  * @brief This displays the page/items on the terminal. It calls the function to
- *        draw the box, print the banner, the heading, subheading, menu, & other contents on the terminal
+ *        draw the box, print the banner, the heading, subheading, menu, & other contents on the terminal.
+ *        The page without a highlight is kept as a template, so the next frames only blit it & patch the
+ *        highlighted line.
  *
  * @param box_offset The offset value/position of the box
  * @param highlight The line number on the menu to be highlighted
@@ -346,19 +516,28 @@ void display_main_page(const int box_offset, const size_t highlight, const size_
 
     const int y_coord = 1;
     const int x_coord = box_offset;
-    draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
+    const uint64_t key = main_page_key(box_offset, len, player, heading, sub_heading, emojis, menus);
 
-    display_header(box_offset, heading, player);
+    if (!template_load(key)) {
+        draw_box(x_coord, y_coord, MIN_BOX_WIDTH, MIN_BOX_HEIGHT);
 
-    if (sub_heading != NULL) {
-        const int padding = get_padding(strlen(sub_heading));
-        mvprint(x_coord + padding, y_coord + HEADER_HEIGHT + 2, BOLD,
-                "%s", sub_heading);
-    }
+        display_header(box_offset, heading, player);
+
+        if (sub_heading != NULL) {
+            const int padding = get_padding(width_str(sub_heading));
+            mvprint(x_coord + padding, y_coord + HEADER_HEIGHT + 2, BOLD,
+                    "%s", sub_heading);
+        }
 
-    print_menu(x_coord, y_coord + HEADER_HEIGHT + 2, highlight, len, emojis, menus);
+        print_menu(x_coord, y_coord + HEADER_HEIGHT + 2, len, len, emojis, menus);
 
-    display_footer(box_offset);
+        display_footer(box_offset);
+        template_store(key);
+    }
+
+    if (highlight < len) {
+        print_menu_item(x_coord, y_coord + HEADER_HEIGHT + 2, highlight, INVERT, emojis, menus);
+    }
 }
 
 
@@ -369,46 +548,47 @@ void display_main_page(const int box_offset, const size_t highlight, const size_
  */
 void display_footer(const int box_offset) {
     const int y_coord = MIN_BOX_HEIGHT;
-    const int x_coord = box_offset + get_padding(strlen(COPYRIGHT) - 4);
+    const int x_coord = box_offset + get_padding(width_str(COPYRIGHT));
 
     mvprint(x_coord, y_coord, DIM, "%s", COPYRIGHT);
 }
 
 
+/**
+ * @brief This function prints a single line of the menu, the lines are laid out two per row
+ *
+ * @param x X-coordinate value of the menu
+ * @param y Y-coordinate value of the menu
+ * @param index The line number to be printed
+ * @param style The text style of the line (ie: INVERT for the highlighted line)
+ * @param emoji The emojis associated with each line
+ * @param content The content of the menu variable
+ */
+void print_menu_item(const int x, const int y, const size_t index, const int style,
+    char emoji[][BADGE_SIZE], char content[][BUF_SIZE]) {
+
+    const int item_x = index % 2 == 0 ? x + 20 : x + MIN_BOX_WIDTH / 2 + 10;
+    const int item_y = y + 2 * (int)(index / 2 + 1);
+
+    mvprint(item_x, item_y, style, "%s %s", emoji[index], content[index]);
+}
+
+
 /**
  * @brief This function prints the menu/options while highlighting the line for users to select
  *
- * @param highlight The line number to be highlighted
+ * @param highlight The line number to be highlighted, 'len' for none
  * @param len The number of lines to be printed
  * @param emoji The emojis associated with each line
  * @param content The content of the menu variable
  * @param x X-coordinate value of the cursor
  * @param y Y-coordinate value of the cursor
  */
-void print_menu(const int x, int y, const size_t highlight,
+void print_menu(const int x, const int y, const size_t highlight,
     const size_t len, char emoji[][BADGE_SIZE], char content[][BUF_SIZE]) {
 
     for (size_t i = 0; i < len; i++) {
-        if (i == highlight) {
-            mvprint(x + 20, y += 2, INVERT,
-                    "%s %s", emoji[i], content[i]);
-        } else {
-            mvprint(x + 20, y += 2, BOLD,
-                    "%s %s", emoji[i], content[i]);
-        }
-
-        i++;
-        if (i < len) {
-            const int tmp_x = MIN_BOX_WIDTH / 2 + 10;
-            if (i == highlight) {
-                mvprint(x + tmp_x, y, INVERT,
-                        "%s %s", emoji[i], content[i]);
-            } else {
-                mvprint(x + tmp_x, y, BOLD,
-                        "%s %s", emoji[i], content[i]);
-            }
-        }
-        fflush(stdout);
+        print_menu_item(x, y, i, i == highlight ? INVERT : BOLD, emoji, content);
     }
 }
 
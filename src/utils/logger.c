@@ -0,0 +1,338 @@
+#include <strings.h>
+#include <semaphore.h>
+
+#include "../../include/logger.h"
+#include "../../include/utilities.h"
+#include "../../include/crash.h"
+
+
+// TODO : A slot of the ring of records
+typedef struct LOG_ENTRY {
+    atomic_size_t sequence;     //? Position the slot is free for, or that position + 1 once the record is written
+    loglevel_t    level;
+    int           line;
+    time_t        time;
+    const char   *func;
+    const char   *file;
+    char          message[LOG_RECORD];
+} lentry_t;
+
+// TODO : A slot of the rate limiter, a call site hashing to a slot held by another one takes it over
+typedef struct LOG_SITE {
+    atomic_uintptr_t key;
+    atomic_llong  second;
+    atomic_uint   count;        //? Records logged during that second
+} lsite_t;
+
+static lentry_t       ring[LOG_RING];
+static atomic_size_t  tail;                 //? Next position claimed by a producer
+static size_t         head;                 //? Next position read by the flusher, only the flusher moves it
+static lsite_t        sites[LOG_SITES];
+
+static atomic_int     threshold = LEVEL_INFO;
+static atomic_size_t  dropped;              //? Records lost because the ring was full
+static atomic_size_t  suppressed;           //? Records lost to the rate limiter
+static atomic_bool    stopping;
+
+static sem_t          pending;              //? Posted once per record, the flusher sleeps on it
+static pthread_t      flusher;
+static atomic_bool    running;
+static int            logfd = VALUE_ERROR;
+static pthread_once_t started = PTHREAD_ONCE_INIT;
+
+//? Lines are written in batches of this size, the longest line always fits
+static char batch[0x00002000];
+
+static const char *const LEVELS[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+
+/**
+ * @brief This function gives the timestamp of a record. The string is only formatted when the second changes,
+ *        it is only called by the flusher.
+ *
+ * @param now The time of the record
+ *
+ * @returns A pointer to the cached timestamp
+ */
+static const char *log_timestamp(const time_t now) {
+    static time_t cached = VALUE_ERROR;
+    static char stamp[DATE_SIZE];
+
+    if (now != cached) {
+        struct tm tm;
+        localtime_r(&now, &tm);
+        strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &tm);
+        cached = now;
+    }
+    return stamp;
+}
+
+
+/**
+ * @brief This function writes the lines of the batch to the log file. The file is opened on the first write,
+ *        & again on the next batch if that failed, the lines are dropped meanwhile.
+ *
+ * @param len The number of bytes in the batch
+ */
+static void log_commit(const size_t len) {
+    if (logfd == VALUE_ERROR) {
+        logfd = open(ERROR_LOGPATH, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    }
+    for (size_t done = 0; logfd != VALUE_ERROR && done < len;) {
+        const ssize_t n = write(logfd, batch + done, len - done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return;
+        }
+        done += (size_t)n;
+    }
+}
+
+
+/**
+ * @brief This function formats a record as one line, the line breaks of its message are turned into spaces.
+ *        ie: 2024-01-01 12:00:00 ERROR database.c:668 update_player_stats : Failed to prepare statement
+ *
+ * @param entry A pointer to the record
+ * @param dest A pointer to the buffer receiving the line
+ * @param size The number of bytes available, at least LOG_RECORD + 0x80
+ *
+ * @returns The number of bytes of the line
+ */
+static size_t log_format(const lentry_t *entry, char *dest, const size_t size) {
+    const char *file = strrchr(entry->file, '/') ? strrchr(entry->file, '/') + 1 : entry->file;
+    size_t len = (size_t)snprintf(dest, size, "%s %-5s %.32s:%i %.48s : ", log_timestamp(entry->time),
+                                  LEVELS[entry->level], file, entry->line, entry->func);
+
+    for (const char *s = entry->message; *s != NULL_TERM && len < size - 1; s++) {
+        dest[len++] = *s == ENTER_KEY || *s == '\r' || *s == '\t' ? SPACE_BAR : *s;
+    }
+    while (len > 0 && dest[len - 1] == SPACE_BAR) {
+        len -= 1;
+    }
+    dest[len++] = ENTER_KEY;
+    return len;
+}
+
+
+/**
+ * @brief This function writes every record of the ring to the log file, followed by a line counting
+ *        the records that were dropped or rate limited since the last time
+ */
+static void log_drain(void) {
+    const size_t line = LOG_RECORD + 0x80;
+    size_t len = 0;
+
+    for (;;) {
+        lentry_t *entry = &ring[head & (LOG_RING - 1)];
+        if (atomic_load_explicit(&entry->sequence, memory_order_acquire) != head + 1) {
+            break;
+        }
+        if (sizeof(batch) - len < line) {
+            log_commit(len);
+            len = 0;
+        }
+        len += log_format(entry, batch + len, line);
+
+        //? Hands the slot back to the producers for the next lap of the ring
+        atomic_store_explicit(&entry->sequence, head + LOG_RING, memory_order_release);
+        head += 1;
+    }
+
+    const size_t lost = atomic_exchange(&dropped, 0), limited = atomic_exchange(&suppressed, 0);
+    if ((lost > 0 || limited > 0) && sizeof(batch) - len >= line) {
+        len += (size_t)snprintf(batch + len, line, "%s %-5s logger : %zu records dropped, %zu rate limited\n",
+                                log_timestamp(time(NULL)), LEVELS[LEVEL_WARN], lost, limited);
+    }
+    if (len > 0) {
+        log_commit(len);
+    }
+}
+
+
+/**
+ * @brief This function is the entry point of the flusher thread, it writes the records as they are posted
+ *
+ * @param arg no use
+ *
+ * @returns NULL
+ */
+static void *log_main(void *arg) {
+    (void)arg;
+    crash_thread_begin();
+    while (!atomic_load(&stopping)) {
+        if (sem_wait(&pending) != 0 && errno == EINTR) {
+            continue;
+        }
+        //? One wake-up drains every record, the posts of the records already written are consumed here
+        while (sem_trywait(&pending) == 0) {}
+        log_drain();
+    }
+    crash_thread_end();
+    return NULL;
+}
+
+
+/**
+ * @brief This function sets up the ring & starts the flusher thread, it is run once. If the thread can't be
+ *        created, the records wait in the ring until 'log_shutdown' & the ones that don't fit are dropped.
+ */
+static void log_start(void) {
+    for (size_t i = 0; i < LOG_RING; i++) {
+        atomic_init(&ring[i].sequence, i);
+    }
+
+    const char *level = getenv("QUIZBIT_LOG_LEVEL");
+    for (size_t i = 0; level != NULL && i < sizeof(LEVELS) / sizeof(LEVELS[0]); i++) {
+        if (strcasecmp(level, LEVELS[i]) == 0) {
+            atomic_store(&threshold, (int)i);
+        }
+    }
+
+    running = sem_init(&pending, 0, 0) == 0 && pthread_create(&flusher, NULL, log_main, NULL) == 0;
+    atexit(log_shutdown);
+}
+
+
+/**
+ * @brief This function starts the logger. It is also started by the first record, so calling it is only needed
+ *        to start the flusher before the first record is logged.
+ */
+void log_init(void) {
+    pthread_once(&started, log_start);
+}
+
+
+/**
+ * @brief This function stops the flusher & writes the records left in the ring. It is run at exit,
+ *        the records logged after it are written by the next call.
+ */
+void log_shutdown(void) {
+    if (running) {
+        atomic_store(&stopping, true);
+        sem_post(&pending);
+        pthread_join(flusher, NULL);
+        running = false;
+    }
+    log_drain();
+
+    if (logfd != VALUE_ERROR) {
+        close(logfd);
+        logfd = VALUE_ERROR;
+    }
+}
+
+
+/**
+ * @brief This function sets the lowest level of the records that are logged
+ */
+void log_set_level(const loglevel_t level) {
+    atomic_store(&threshold, (int)level);
+}
+
+
+/**
+ * @returns true if records of the level are logged, otherwise false
+ */
+bool log_enabled(const loglevel_t level) {
+    return (int)level >= atomic_load_explicit(&threshold, memory_order_relaxed);
+}
+
+
+/**
+ * @brief This function counts the records of a call site during the current second
+ *
+ * @param file The file of the call site
+ * @param line The line of the call site
+ * @param now The current time
+ *
+ * @returns true if the call site is within its budget of LOG_BURST records per second, otherwise false
+ */
+static bool log_admit(const char *file, const int line, const time_t now) {
+    const uintptr_t key = (uintptr_t)file ^ (uintptr_t)line * 2654435761U;
+    lsite_t *site = &sites[(key ^ key >> 7) & (LOG_SITES - 1)];
+
+    long long second = atomic_load_explicit(&site->second, memory_order_relaxed);
+    if (atomic_exchange(&site->key, key) != key) {
+        //? The budget of the last call site isn't carried over, the count is only approximate then
+        atomic_store(&site->second, (long long)now);
+        atomic_store(&site->count, 0);
+    }
+    else if (second != (long long)now && atomic_compare_exchange_strong(&site->second, &second, (long long)now)) {
+        atomic_store(&site->count, 0);
+    }
+    if (atomic_fetch_add(&site->count, 1) < LOG_BURST) {
+        return true;
+    }
+    atomic_fetch_add(&suppressed, 1);
+    return false;
+}
+
+
+/**
+ * @brief This function logs a record. The message is formatted into a free slot of the ring & the flusher
+ *        is woken, no lock is taken & no file is touched, so it can be called from any thread.
+ *        If the ring is full, the record is dropped & counted.
+ *
+ * @param level The level of the record
+ * @param func A pointer to the function logging the record
+ * @param file A pointer to the file name of the call site
+ * @param line The line number of the call site
+ * @param fmt A pointer to the message
+ * @param args Additional arguments
+ */
+void log_vwrite(const loglevel_t level, const char *func, const char *file, const int line,
+                const char *fmt, va_list args) {
+    pthread_once(&started, log_start);
+    const time_t now = time(NULL);
+    if (!log_enabled(level) || !log_admit(file, line, now)) {
+        return;
+    }
+
+    lentry_t *entry;
+    size_t pos = atomic_load_explicit(&tail, memory_order_relaxed);
+    for (;;) {
+        entry = &ring[pos & (LOG_RING - 1)];
+        const size_t sequence = atomic_load_explicit(&entry->sequence, memory_order_acquire);
+        const intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            //? The slot still holds the record of the last lap, the flusher is behind
+            atomic_fetch_add(&dropped, 1);
+            return;
+        }
+        else {
+            pos = atomic_load_explicit(&tail, memory_order_relaxed);
+        }
+    }
+
+    entry->level = level;
+    entry->line = line;
+    entry->time = now;
+    entry->func = func;
+    entry->file = file;
+    vsnprintf(entry->message, sizeof(entry->message), fmt, args);
+    atomic_store_explicit(&entry->sequence, pos + 1, memory_order_release);
+
+    if (running) {
+        sem_post(&pending);
+    }
+}
+
+
+/**
+ * @brief This function logs a record, see 'log_vwrite'
+ */
+void log_write(const loglevel_t level, const char *func, const char *file, const int line, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    log_vwrite(level, func, file, line, fmt, args);
+    va_end(args);
+}
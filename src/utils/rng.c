@@ -0,0 +1,128 @@
+#include <sys/random.h>
+
+#include "../../include/rng.h"
+#include "../../include/utilities.h"
+
+
+/**
+ * @returns The next value of a splitmix64 sequence, which spreads a seed over the state of a generator
+ */
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+
+/**
+ * @returns A value rotated left by k bits
+ */
+static inline uint64_t rotl(const uint64_t value, const int k) {
+    return (value << k) | (value >> (64 - k));
+}
+
+
+/**
+ * @brief This function seeds a generator, the same seed always gives the same sequence
+ *
+ * @param rng A pointer to the generator
+ * @param seed The seed
+ */
+void rng_seed(rng_t *rng, uint64_t seed) {
+    for (size_t i = 0; i < 4; i++) {
+        rng->s[i] = splitmix64(&seed);
+    }
+}
+
+
+/**
+ * @brief This function seeds a generator from the entropy of the system, or from the clock if there is none
+ *
+ * @param rng A pointer to the generator
+ */
+void rng_entropy(rng_t *rng) {
+    uint64_t seed;
+    if (getrandom(&seed, sizeof(seed), GRND_NONBLOCK) != (ssize_t)sizeof(seed)) {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        seed = ((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec) ^ ((uint64_t)getpid() << 32);
+    }
+    rng_seed(rng, seed);
+}
+
+
+/**
+ * @brief This function seeds the generator of a session, from QUIZBIT_SEED if it is set, otherwise from entropy
+ *
+ * @param rng A pointer to the generator
+ *
+ * @returns true if the generator is seeded from QUIZBIT_SEED, otherwise false
+ */
+bool rng_init(rng_t *rng) {
+    const char *value = getenv("QUIZBIT_SEED");
+    if (value != NULL && *value != NULL_TERM) {
+        char *end = NULL;
+        errno = 0;
+        const unsigned long long seed = strtoull(value, &end, 0);
+        if (errno == 0 && *end == NULL_TERM) {
+            rng_seed(rng, seed);
+            log_write(LEVEL_INFO, __func__, __FILE__, __LINE__, "Random generator seeded with %llu\n", seed);
+            return true;
+        }
+        log_error(__func__, __FILE__, __LINE__, "Invalid QUIZBIT_SEED '%s', it is ignored!...\n", value);
+    }
+    rng_entropy(rng);
+    return false;
+}
+
+
+/**
+ * @brief This function seeds a generator from another one, ie: for a background task,
+ *        so the task & the session never share a state & the sequences of both stay replayable
+ *
+ * @param rng A pointer to the generator the seed is drawn from
+ * @param child A pointer to the generator seeded
+ */
+void rng_fork(rng_t *rng, rng_t *child) {
+    rng_seed(child, rng_next(rng));
+}
+
+
+/**
+ * @returns The next 64 random bits of a generator
+ */
+uint64_t rng_next(rng_t *rng) {
+    uint64_t *s = rng->s;
+    const uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+
+/**
+ * @brief This function draws a value below a bound, every value being equally likely (Lemire's method)
+ *
+ * @param rng A pointer to the generator
+ * @param bound The bound, above 0
+ *
+ * @returns A value between 0 & bound - 1
+ */
+uint32_t rng_below(rng_t *rng, const uint32_t bound) {
+    uint64_t product = (rng_next(rng) >> 32) * bound;
+    if ((uint32_t)product < bound) {
+        //? The values whose low half falls below the threshold are redrawn, they would favour some results
+        const uint32_t threshold = -bound % bound;
+        while ((uint32_t)product < threshold) {
+            product = (rng_next(rng) >> 32) * bound;
+        }
+    }
+    return (uint32_t)(product >> 32);
+}
@@ -0,0 +1,91 @@
+#include "../../include/tasks.h"
+#include "../../include/events.h"
+#include "../../include/crash.h"
+#include "../../include/utilities.h"
+
+
+/**
+ * @brief This function is the entry point of the thread of a task
+ *
+ * @param arg A pointer to the task
+ *
+ * @returns NULL
+ */
+static void *task_main(void *arg) {
+    task_t *task = arg;
+    //? The thread has its own alternate signal stack, so a stack overflow of the work is reported too
+    crash_thread_begin();
+    task->result = task->work(task, task->context);
+    crash_thread_end();
+
+    atomic_store(&task->progress, TASK_FINISHED);
+    atomic_store(&task->done, true);
+    events_wake();
+    return NULL;
+}
+
+
+/**
+ * @brief This function runs the work of a task on a new thread. If the thread can't be created,
+ *        the work runs inline, so the caller always gets a completed task from 'task_wait'.
+ *
+ * @param task A pointer to the task
+ * @param work The function doing the work
+ * @param context A pointer passed to the work function
+ *
+ * @returns true if the work runs in the background, otherwise false
+ */
+bool task_start(task_t *task, const task_fn work, void *context) {
+    task->work = work;
+    task->context = context;
+    task->result = false;
+    atomic_init(&task->progress, TASK_STARTED);
+    atomic_init(&task->done, false);
+
+    const int err = pthread_create(&task->thread, NULL, task_main, task);
+    task->started = err == 0;
+    if (!task->started) {
+        log_error(__func__, __FILE__, __LINE__, "pthread_create() : %s\n", strerror(err));
+        task_main(task);
+    }
+    return task->started;
+}
+
+
+/**
+ * @brief This function reports the progress of a task, it is called from the work function
+ *
+ * @param task A pointer to the task, NULL is ignored
+ * @param percent The percent of the work done
+ */
+void task_progress(task_t *task, const uint32_t percent) {
+    if (task == NULL) {
+        return;
+    }
+    atomic_store(&task->progress, percent < TASK_FINISHED ? percent : TASK_FINISHED);
+    events_wake();
+}
+
+
+/**
+ * @returns true if the work of the task completed, otherwise false
+ */
+bool task_done(task_t *task) {
+    return atomic_load(&task->done);
+}
+
+
+/**
+ * @brief This function waits for the work of a task to complete & releases its thread
+ *
+ * @param task A pointer to the task
+ *
+ * @returns The result of the work
+ */
+bool task_wait(task_t *task) {
+    if (task->started) {
+        pthread_join(task->thread, NULL);
+        task->started = false;
+    }
+    return task->result;
+}
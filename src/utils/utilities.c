@@ -1,5 +1,10 @@
 #include "../../include/console.h"
 #include "../../include/utilities.h"
+#include "../../include/render.h"
+#include "../../include/output.h"
+#include "../../include/input.h"
+#include "../../include/events.h"
+#include "../../include/keys.h"
 
 
 /**
@@ -20,17 +25,15 @@ void exit_program(const int EXIT_CODE) {
 
 
 /**
- * @brief This function is a custom sleep function that delays the process in milliseconds using the nanosleep function
+ * @brief This function is a custom sleep function that delays the process in milliseconds.
+ *        The current frame is presented first, so whatever was drawn stays visible during the delay.
+ *        The event loop keeps running meanwhile, so key presses are buffered & signals are handled.
  *
  * @param milliseconds The amount of time to delay in milliseconds
  */
 void delay(const uint32_t milliseconds) {
-    struct timespec sleep_time;
-
-    sleep_time.tv_sec = milliseconds / 1000;
-    sleep_time.tv_nsec = milliseconds % 1000 * 1000000L;
-
-    nanosleep(&sleep_time, NULL);
+    render_present();
+    events_sleep(milliseconds);
 }
 
 
@@ -74,15 +77,20 @@ void print(const char *fmt,...) {
     va_list args;
 
     va_start(args, fmt);
-    vfprintf(stdout, fmt, args);
+    if (render_active()) {
+        render_vprintf(fmt, args);
+        va_end(args);
+        return;
+    }
+    out_vprintf(fmt, args);
     va_end(args);
 
-    fflush(stdout);
+    out_commit();
 }
 
 
 /**
- * @brief This is a custom printf function that prints styled texts to stdout with given X,Y coordinate values
+ * @brief This is a custom printf function that prints styled texts with given X,Y coordinate values
  *
  * @param x_coord X-coordinate of the cursor
  * @param y_coord Y-coordinate of the cursor
@@ -100,11 +108,18 @@ void mvprint(const int x_coord, const int y_coord, const styles_t textStyle, con
 
     va_list args;
     va_start(args, fmt);
-    vfprintf(stdout, fmt, args);
+    if (render_active()) {
+        render_vprintf(fmt, args);
+    }
+    else {
+        out_vprintf(fmt, args);
+    }
     va_end(args);
 
     set_console_text_attr(RESET_ATTR);
-    fflush(stdout);
+    if (!render_active()) {
+        out_commit();
+    }
 }
 
 
@@ -120,22 +135,25 @@ void print_error(const int x_coord, const int y_coord, const char *error,...) {
     va_list args;
     va_start(args, error);
 
-    const RGBset_t color_codes = {
-        .foreground = {255, 255, 255}, //? Foreground color code (White)
-        .background = {255, 0, 0}      //? Background color code (Red)
-    };
-
     set_console_text_attr(BOLD);
-    set_console_color_attr(color_codes);
+    set_console_theme(THEME_ERROR);
 
+    //? The message goes through the same sink as the cursor movement, so both land in order
     set_console_cursor_position(x_coord, y_coord);
-    fprintf(stderr, " [%s] ", ERROR_EMOJI);
-
-    vfprintf(stderr, error, args);
+    if (render_active()) {
+        print(" [%s] ", ERROR_EMOJI);
+        render_vprintf(error, args);
+    }
+    else {
+        out_printf(" [%s] ", ERROR_EMOJI);
+        out_vprintf(error, args);
+    }
     va_end(args);
 
     set_console_text_attr(RESET_ATTR);
-    fflush(stdout);
+    if (!render_active()) {
+        out_commit();
+    }
 }
 
 
@@ -151,27 +169,30 @@ void print_success(const int x_coord, const int y_coord, const char *success,...
     va_list args;
     va_start(args, success);
 
-    const RGBset_t color_codes = {
-        .foreground = {255, 255, 255}, //? Foreground color code (White)
-        .background = {0, 115, 2}      //? Background color code (green)
-    };
-
     set_console_text_attr(BOLD);
-    set_console_color_attr(color_codes);
+    set_console_theme(THEME_SUCCESS);
 
     set_console_cursor_position(x_coord, y_coord);
-    fprintf(stdout, " [%s] ", SUCCESS_EMOJI);
-
-    vfprintf(stdout, success, args);
+    if (render_active()) {
+        print(" [%s] ", SUCCESS_EMOJI);
+        render_vprintf(success, args);
+    }
+    else {
+        out_printf(" [%s] ", SUCCESS_EMOJI);
+        out_vprintf(success, args);
+    }
     va_end(args);
 
     set_console_text_attr(RESET_ATTR);
-    fflush(stdout);
+    if (!render_active()) {
+        out_commit();
+    }
 }
 
 
 /**
- * @brief This function logs error messages to a log file
+ * @brief This function logs error messages to the log file, through the logger so the caller never waits
+ *        on the file. Each message is written as one line, with the time, file, line & function.
  *
  * @param __FUNC A pointer to the function where the error is encountered
  * @param __FILE A pointer to the file name where the error is encountered
@@ -180,29 +201,10 @@ void print_success(const int x_coord, const int y_coord, const char *success,...
  * @param ... Additional arguments
  */
 void log_error(const char *__FUNC, const char *__FILE, const int __LINE, const char *fmt, ...) {
-    FILE *logFile = fopen(ERROR_LOGPATH, "a");
-    if (NULL == logFile) {
-        mvprint(1, 1, BOLD, "Could not open log file : Quitting...");
-        cgetch();
-        exit_program(EXIT_FAILURE);
-    }
-
     va_list args;
     va_start(args, fmt);
-
-    const char *str = strrchr(__FILE, '/') ? strrchr(__FILE, '/') + 1 : __FILE;
-    char *time_buffer = get_current_datetime();
-    fprintf(logFile, "FILE : %s \n"
-                           "LINE : %i \n"
-                           "FUNC : %s \n"
-                           "TIME : %s \n"
-                           "ERROR MESSAGE ━━━ ", str, __LINE, __FUNC, time_buffer);
-    vfprintf(logFile, fmt, args);
-    fprintf(logFile, "\n");
-
+    log_vwrite(LEVEL_ERROR, __FUNC, __FILE, __LINE, fmt, args);
     va_end(args);
-    fclose(logFile);
-    free(time_buffer);
 }
 
 
@@ -223,27 +225,23 @@ char *get_current_datetime(void) {
 
 
 /**
- * @author Gavin A. S. Cheng
- * @see https://ascheng.medium.com/linux-getch-for-unix-c2c829721a30
- *
- * @brief This function is a custom getch function for linux
- *        The function is cited from a blog post on medium.com
- *        check the link above for reference.
+ * @brief This function reads one key press from the input layer. The terminal stays in non-canonical mode
+ *        for the whole game, so no terminal attributes are changed per key press.
+ *        The event loop runs while waiting, so timers & signals are still served.
+ *        Escape sequences are decoded, so an arrow key is returned as a single key code.
+ *        The program exits if stdin is closed, since no key press can arrive anymore.
  *
- * @returns the character that was read by the function
+ * @returns the character, or the key code of 'ctrl_t', that was read by the function
  */
 int cgetch(void) {
-    //? Declare termios structures and store the current terminal settings and store them in old_tio
-    struct termios old_tio, new_tio;
-    tcgetattr(STDIN_FILENO, &old_tio);
-
-    //? Modify new_tio to disable canonical mode & echo and apply the settings to the terminal
-    new_tio = old_tio;
-    new_tio.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &new_tio);
-
-    //? Read a character, restore the original terminal settings & return the read character
-    const int c = getchar();
-    tcsetattr(STDIN_FILENO, TCSANOW, &old_tio);
+    //? Show the frame drawn so far before blocking for the key press
+    render_present();
+
+    kevent_t event;
+    const int c = keys_read(&event);
+    if (c == INPUT_EOF) {
+        log_error(__func__, __FILE__, __LINE__, "stdin closed, no more input to read!...\n");
+        exit_program(EXIT_FAILURE);
+    }
     return c;
 }